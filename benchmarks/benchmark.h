@@ -0,0 +1,106 @@
+#ifndef HV_CONFIGURATION_BENCHMARK_H
+#define HV_CONFIGURATION_BENCHMARK_H
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+/**
+ * Benchmark state
+ *
+ * A benchmark builds its data for size() items, then times its measured code
+ * with measure(). The code is run several times and the fastest run is
+ * reported, per item.
+ */
+class BenchmarkState {
+public:
+	/// Measure result
+	struct Result {
+		/// Measure label
+		std::string label;
+
+		/// Number of items processed by one run
+		std::size_t items;
+
+		/// Fastest run, in nanoseconds
+		double bestNs;
+
+		/// Median run, in nanoseconds
+		double medianNs;
+	};
+
+	BenchmarkState(std::size_t size, unsigned runs);
+
+	/**
+	 * Get the problem size
+	 *
+	 * @return Number of parameters, keys or sources to work on
+	 */
+	std::size_t size() const;
+
+	/**
+	 * Time a piece of code
+	 *
+	 * @param label Measure label
+	 * @param items Number of items processed by one run of body
+	 * @param body Measured code
+	 * @param setup Code run before each run of body, not measured
+	 */
+	void measure(const std::string& label, std::size_t items, const std::function<void()>& body,
+			const std::function<void()>& setup = std::function<void()>());
+
+	/**
+	 * Get the measure results
+	 *
+	 * @return Results, in measure order
+	 */
+	const std::vector<Result>& getResults() const;
+
+private:
+	/// Problem size
+	std::size_t problemSize;
+
+	/// Number of runs per measure
+	unsigned runs;
+
+	/// Measure results
+	std::vector<Result> results;
+};
+
+/// Benchmark function
+typedef void (*BenchmarkFunction)(BenchmarkState& state);
+
+/**
+ * Static benchmark registration, see HV_CFG_BENCHMARK
+ */
+struct BenchmarkRegistration {
+	BenchmarkRegistration(const char* name, std::size_t defaultSize, BenchmarkFunction function);
+};
+
+/**
+ * Declare a benchmark, e.g.:
+ * HV_CFG_BENCHMARK(yamlLookup, 100000) {
+ *     // Build state.size() items
+ *     state.measure("lookup", state.size(), [&]() { ... });
+ * }
+ */
+#define HV_CFG_BENCHMARK(name, defaultSize) \
+	static void name(BenchmarkState& state); \
+	static BenchmarkRegistration name##Registration(#name, defaultSize, &name); \
+	static void name(BenchmarkState& state)
+
+/// Written by benchmarkKeep
+extern const void* volatile benchmarkSink;
+
+/**
+ * Keep a value alive so that the compiler does not remove its computation
+ *
+ * @param value Value
+ */
+template<typename T>
+inline void benchmarkKeep(const T& value) {
+	benchmarkSink = &value;
+}
+
+#endif // HV_CONFIGURATION_BENCHMARK_H
@@ -0,0 +1,167 @@
+#include "benchmark.h"
+
+#include <cstdio>
+#include <functional>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include <hv/configuration.h>
+
+namespace {
+
+typedef std::vector<std::unique_ptr<hv::cfg::Param<int> > > IntParams;
+
+/**
+ * Create integer parameters in the broker bound to the calling thread
+ *
+ * @param prefix Parameter name prefix
+ * @param size Number of parameters
+ * @return Parameters
+ */
+IntParams createIntParams(const std::string& prefix, std::size_t size) {
+	IntParams params;
+	params.reserve(size);
+	for(std::size_t i = 0; i < size; ++i) {
+		params.emplace_back(new hv::cfg::Param<int>(prefix + std::to_string(i), static_cast<int>(i)));
+	}
+	return params;
+}
+
+/**
+ * Write all parameters
+ *
+ * @param params Parameters
+ * @param value Value
+ */
+void writeIntParams(IntParams& params, int value) {
+	for(std::unique_ptr<hv::cfg::Param<int> >& param : params) {
+		*param = value;
+	}
+}
+
+} // namespace
+
+HV_CFG_BENCHMARK(checkpoint, 1000000) {
+	hv::cfg::Broker broker("Checkpoint benchmark broker", false);
+	hv::cfg::BrokerContext context(broker);
+	IntParams params = createIntParams("checkpointParam", state.size());
+
+	std::stringstream stream;
+	state.measure("save", params.size(), [&]() {
+		broker.checkpoint(stream);
+	}, [&]() {
+		stream.str(std::string());
+		stream.clear();
+	});
+	const std::string checkpoint = stream.str();
+	state.measure("restore", params.size(), [&]() {
+		broker.restore(stream);
+	}, [&]() {
+		stream.str(checkpoint);
+		stream.clear();
+	});
+
+	// Deltas only cost the modified parameters: one in a hundred here
+	const std::size_t stride = 100;
+	int round = 0;
+	state.measure("delta", (params.size() + stride - 1) / stride, [&]() {
+		broker.checkpointDelta(stream);
+	}, [&]() {
+		++round;
+		for(std::size_t i = 0; i < params.size(); i += stride) {
+			*params[i] = round;
+		}
+		stream.str(std::string());
+		stream.clear();
+	});
+}
+
+HV_CFG_BENCHMARK(brokerExport, 1000000) {
+	hv::cfg::Broker broker("Export benchmark broker", false);
+	hv::cfg::BrokerContext context(broker);
+	IntParams params = createIntParams("exportParam", state.size());
+
+	const std::string filepath("hvcfg-benchmark-export.out");
+	hv::cfg::ExportOptions options;
+	options.format = hv::cfg::EXPORT_YAML;
+	state.measure("yaml file", params.size(), [&]() {
+		broker.exportParams(filepath, options);
+	});
+	options.format = hv::cfg::EXPORT_JSON;
+	state.measure("json file", params.size(), [&]() {
+		broker.exportParams(filepath, options);
+	});
+	std::remove(filepath.c_str());
+}
+
+HV_CFG_BENCHMARK(valueArena, 1000000) {
+	hv::cfg::Broker broker("Arena benchmark broker", false);
+	hv::cfg::BrokerContext context(broker);
+	broker.enableValueArena();
+	IntParams params = createIntParams("arenaParam", state.size());
+
+	hv::cfg::ValueArena::Snapshot snapshot;
+	state.measure("value snapshot", params.size(), [&]() {
+		snapshot = broker.takeValueSnapshot();
+	});
+	state.measure("value restore", params.size(), [&]() {
+		broker.restoreValueSnapshot(snapshot);
+	}, [&]() {
+		writeIntParams(params, -1);
+	});
+	state.measure("config snapshot", params.size(), [&]() {
+		benchmarkKeep(broker.takeSnapshot());
+	});
+}
+
+HV_CFG_BENCHMARK(resetAll, 1000000) {
+	hv::cfg::Broker broker("Reset benchmark broker", false);
+	hv::cfg::BrokerContext context(broker);
+	broker.enableValueArena();
+	IntParams params = createIntParams("resetParam", state.size());
+
+	// Every value differs from its target before each reset
+	writeIntParams(params, 1);
+	const hv::cfg::ConfigSnapshot baseline = broker.takeSnapshot();
+	const std::function<void()> modify = [&]() {
+		writeIntParams(params, -1);
+	};
+	state.measure("default", params.size(), [&]() {
+		broker.resetAll(hv::cfg::RESET_DEFAULT, hv::cfg::RESET_RUN_CALLBACKS);
+	}, modify);
+	state.measure("default skip cb", params.size(), [&]() {
+		broker.resetAll(hv::cfg::RESET_DEFAULT, hv::cfg::RESET_SKIP_CALLBACKS);
+	}, modify);
+	state.measure("preset", params.size(), [&]() {
+		broker.resetAll(hv::cfg::RESET_PRESET, hv::cfg::RESET_RUN_CALLBACKS);
+	}, modify);
+	state.measure("snapshot", params.size(), [&]() {
+		broker.resetAll(hv::cfg::RESET_SNAPSHOT, hv::cfg::RESET_RUN_CALLBACKS, &baseline);
+	}, modify);
+}
+
+HV_CFG_BENCHMARK(snapshotDiff, 1000000) {
+	hv::cfg::Broker broker("Diff benchmark broker", false);
+	hv::cfg::BrokerContext context(broker);
+	broker.enableValueArena();
+	IntParams params = createIntParams("diffParam", state.size());
+
+	// One parameter in a hundred differs
+	const hv::cfg::ConfigSnapshot before = broker.takeSnapshot();
+	for(std::size_t i = 0; i < params.size(); i += 100) {
+		*params[i] = -1;
+	}
+	const hv::cfg::ConfigSnapshot after = broker.takeSnapshot();
+	state.measure("snapshots", params.size(), [&]() {
+		hv::cfg::ConfigDiff result;
+		broker.diff(before, after, result);
+		benchmarkKeep(result);
+	});
+	state.measure("current values", params.size(), [&]() {
+		hv::cfg::ConfigDiff result;
+		broker.diff(before, result);
+		benchmarkKeep(result);
+	});
+}
@@ -0,0 +1,120 @@
+#include "benchmark.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <systemc>
+#include <hv/configuration.h>
+#include <cci_configuration>
+
+namespace {
+
+struct BenchmarkEntry {
+	const char* name;
+	std::size_t defaultSize;
+	BenchmarkFunction function;
+};
+
+std::vector<BenchmarkEntry>& getBenchmarks() {
+	static std::vector<BenchmarkEntry> benchmarks;
+	return benchmarks;
+}
+
+void usage(const char* program) {
+	std::printf("Usage: %s [--size N] [--runs N] [filter...]\n"
+			"Runs the benchmarks whose name contains one of the filters (all by default).\n",
+			program);
+}
+
+} // namespace
+
+const void* volatile benchmarkSink = nullptr;
+
+BenchmarkState::BenchmarkState(std::size_t size, unsigned runs) :
+		problemSize(size), runs(runs), results() {
+}
+
+std::size_t BenchmarkState::size() const {
+	return problemSize;
+}
+
+void BenchmarkState::measure(const std::string& label, std::size_t items, const std::function<void()>& body,
+		const std::function<void()>& setup) {
+	std::vector<double> times;
+	times.reserve(runs);
+	for(unsigned run = 0; run < runs; ++run) {
+		if(setup) {
+			setup();
+		}
+		const std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+		body();
+		const std::chrono::steady_clock::time_point stop = std::chrono::steady_clock::now();
+		times.push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+	}
+	std::sort(times.begin(), times.end());
+	Result result;
+	result.label = label;
+	result.items = items;
+	result.bestNs = times.front();
+	result.medianNs = times[times.size() / 2];
+	results.push_back(result);
+}
+
+const std::vector<BenchmarkState::Result>& BenchmarkState::getResults() const {
+	return results;
+}
+
+BenchmarkRegistration::BenchmarkRegistration(const char* name, std::size_t defaultSize,
+		BenchmarkFunction function) {
+	BenchmarkEntry entry = {name, defaultSize, function};
+	getBenchmarks().push_back(entry);
+}
+
+int sc_main(int argc, char* argv[])
+{
+	std::size_t size = 0;
+	unsigned runs = 5;
+	std::vector<std::string> filters;
+	for(int i = 1; i < argc; ++i) {
+		if(std::strcmp(argv[i], "--size") == 0 && i + 1 < argc) {
+			size = std::strtoull(argv[++i], nullptr, 10);
+		} else if(std::strcmp(argv[i], "--runs") == 0 && i + 1 < argc) {
+			runs = std::max(1, std::atoi(argv[++i]));
+		} else if(argv[i][0] == '-') {
+			usage(argv[0]);
+			return EXIT_FAILURE;
+		} else {
+			filters.push_back(argv[i]);
+		}
+	}
+
+	hv::cfg::Broker hiventiveBroker("Hiventive broker");
+	cci::cci_register_broker(hiventiveBroker.getCCIBroker());
+
+	std::vector<BenchmarkEntry> benchmarks(getBenchmarks());
+	std::sort(benchmarks.begin(), benchmarks.end(), [](const BenchmarkEntry& lhs, const BenchmarkEntry& rhs) {
+		return std::strcmp(lhs.name, rhs.name) < 0;
+	});
+	for(const BenchmarkEntry& benchmark : benchmarks) {
+		bool selected = filters.empty();
+		for(const std::string& filter : filters) {
+			selected = selected || std::strstr(benchmark.name, filter.c_str()) != nullptr;
+		}
+		if(!selected) {
+			continue;
+		}
+		BenchmarkState state(size ? size : benchmark.defaultSize, runs);
+		benchmark.function(state);
+		for(const BenchmarkState::Result& result : state.getResults()) {
+			const double items = static_cast<double>(std::max<std::size_t>(result.items, 1));
+			std::printf("%-24s %-20s %10zu items %12.1f ns/item (median %.1f) %10.3f ms\n",
+					benchmark.name, result.label.c_str(), result.items,
+					result.bestNs / items, result.medianNs / items, result.bestNs / 1e6);
+		}
+		std::fflush(stdout);
+	}
+	return EXIT_SUCCESS;
+}
@@ -0,0 +1,68 @@
+#include "benchmark.h"
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <systemc>
+#include <hv/configuration.h>
+
+namespace {
+
+/**
+ * Module holding many parameters, named from the module hierarchy
+ */
+class FieldsModule : public sc_core::sc_module {
+public:
+	FieldsModule(sc_core::sc_module_name name, std::size_t size) :
+			sc_core::sc_module(name), fields() {
+		fields.reserve(size);
+		for(std::size_t i = 0; i < size; ++i) {
+			fields.emplace_back(new hv::cfg::Param<int>("field" + std::to_string(i), 0));
+		}
+	}
+
+private:
+	std::vector<std::unique_ptr<hv::cfg::Param<int> > > fields;
+};
+
+} // namespace
+
+HV_CFG_BENCHMARK(callbackWrite, 10000000) {
+	hv::cfg::Broker broker("Callback benchmark broker", false);
+	hv::cfg::BrokerContext context(broker);
+	hv::cfg::Param<int> param("callbackParam", 0);
+
+	state.measure("no callback", state.size(), [&]() {
+		for(std::size_t i = 0; i < state.size(); ++i) {
+			param = static_cast<int>(i);
+		}
+	});
+
+	std::uint64_t writes = 0;
+	param.registerPostWriteCallback([&writes](const hv::cfg::ParamWriteEvent<int>&) {
+		++writes;
+	});
+	state.measure("hv callback", state.size(), [&]() {
+		for(std::size_t i = 0; i < state.size(); ++i) {
+			param = static_cast<int>(i);
+		}
+	});
+	benchmarkKeep(writes);
+}
+
+HV_CFG_BENCHMARK(moduleParams, 10000) {
+	hv::cfg::Broker broker("Module benchmark broker", false);
+	hv::cfg::BrokerContext context(broker);
+
+	// Each run builds a new module, named after the run
+	std::unique_ptr<FieldsModule> module;
+	unsigned run = 0;
+	state.measure("construct", state.size(), [&]() {
+		module.reset(new FieldsModule(("fieldsModule" + std::to_string(run)).c_str(), state.size()));
+	}, [&]() {
+		module.reset();
+		++run;
+	});
+}
@@ -0,0 +1,131 @@
+#include "benchmark.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <hv/configuration.h>
+
+namespace {
+
+/// Number of leaves per YAML map
+const std::size_t yamlLeaves = 8;
+
+/**
+ * Write a YAML file of modules holding a map of leaves each
+ *
+ * @param filepath File path
+ * @param firstModule Index of the first module
+ * @param modules Number of modules
+ */
+void writeYAMLFile(const std::string& filepath, std::size_t firstModule, std::size_t modules) {
+	std::ofstream file(filepath.c_str());
+	for(std::size_t i = firstModule; i < firstModule + modules; ++i) {
+		file << "module" << i << ":\n  regs:\n";
+		for(std::size_t j = 0; j < yamlLeaves; ++j) {
+			file << "    r" << j << ": " << i + j << "\n";
+		}
+	}
+}
+
+} // namespace
+
+HV_CFG_BENCHMARK(yamlLookup, 100000) {
+	const std::size_t modules = std::max<std::size_t>(state.size() / yamlLeaves, 1);
+	const std::string filepath("hvcfg-benchmark-lookup.yaml");
+	writeYAMLFile(filepath, 0, modules);
+	hv::cfg::YAML yaml(filepath, false);
+	std::remove(filepath.c_str());
+	if(!yaml.isLoaded()) {
+		return;
+	}
+
+	std::vector<std::string> leafKeys;
+	std::vector<std::string> mapKeys;
+	for(std::size_t i = 0; i < modules; ++i) {
+		mapKeys.push_back("module" + std::to_string(i) + ".regs");
+		for(std::size_t j = 0; j < yamlLeaves; ++j) {
+			leafKeys.push_back(mapKeys.back() + ".r" + std::to_string(j));
+		}
+	}
+
+	state.measure("leaf", leafKeys.size(), [&]() {
+		for(const std::string& key : leafKeys) {
+			benchmarkKeep(yaml.getCCIValue(key));
+		}
+	});
+	state.measure("subtree", mapKeys.size(), [&]() {
+		for(const std::string& key : mapKeys) {
+			benchmarkKeep(yaml.getCCIValue(key));
+		}
+	});
+}
+
+HV_CFG_BENCHMARK(loaderLoad, 1000000) {
+	const unsigned sources = std::max(std::thread::hardware_concurrency(), 2u);
+	const std::size_t modules = std::max<std::size_t>(state.size() / yamlLeaves / sources, 1);
+	std::vector<std::string> filepaths;
+	for(unsigned i = 0; i < sources; ++i) {
+		filepaths.push_back("hvcfg-benchmark-source" + std::to_string(i) + ".yaml");
+		writeYAMLFile(filepaths.back(), i * modules, modules);
+	}
+
+	std::unique_ptr<hv::cfg::Loader> loader;
+	const std::function<void()> setup = [&]() {
+		loader.reset(new hv::cfg::Loader());
+		for(const std::string& filepath : filepaths) {
+			loader->addYAML(filepath);
+		}
+	};
+	const std::size_t items = modules * yamlLeaves * sources;
+	state.measure("1 job", items, [&]() {
+		loader->load(1);
+	}, setup);
+	state.measure(std::to_string(sources) + " jobs", items, [&]() {
+		loader->load(sources);
+	}, setup);
+
+	loader.reset();
+	for(const std::string& filepath : filepaths) {
+		std::remove(filepath.c_str());
+	}
+}
+
+HV_CFG_BENCHMARK(environmentLookup, 10000) {
+	// Unrelated variables make the process environment large
+	const std::size_t keys = 16;
+	for(std::size_t i = 0; i < state.size(); ++i) {
+		setenv(("HVCFG_BENCHMARK_NOISE_" + std::to_string(i)).c_str(), "noise", true);
+	}
+	std::vector<std::string> keyNames;
+	for(std::size_t i = 0; i < keys; ++i) {
+		keyNames.push_back("top.param" + std::to_string(i));
+		setenv(("HVCFG_BENCHMARK_top__param" + std::to_string(i)).c_str(), "1", true);
+	}
+
+	std::unique_ptr<hv::cfg::Environment> environment;
+	state.measure("construct", 1, [&]() {
+		environment.reset(new hv::cfg::Environment("HVCFG_BENCHMARK_"));
+	}, [&]() {
+		environment.reset();
+	});
+	state.measure("lookup", keys, [&]() {
+		for(const std::string& key : keyNames) {
+			benchmarkKeep(environment->getValue(key));
+		}
+	});
+
+	environment.reset();
+	for(std::size_t i = 0; i < state.size(); ++i) {
+		unsetenv(("HVCFG_BENCHMARK_NOISE_" + std::to_string(i)).c_str());
+	}
+	for(std::size_t i = 0; i < keys; ++i) {
+		unsetenv(("HVCFG_BENCHMARK_top__param" + std::to_string(i)).c_str());
+	}
+}
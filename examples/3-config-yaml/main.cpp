@@ -19,13 +19,17 @@ inline bool operator== (const CustomStruct& lhs, const CustomStruct& rhs)
 		   lhs.size == rhs.size;
 }
 
+// CCI converter, data category and checkpoint encoding of CustomStruct
+HV_CFG_STRUCT(CustomStruct, message, size)
+
 class ConfigModule : public sc_core::sc_module {
 	SC_HAS_PROCESS(ConfigModule);
 public:
 	ConfigModule(sc_core::sc_module_name name) :
 		sc_core::sc_module(name),
 		intParam("intParam", 5),
-		customParam("customParam", CustomStruct()) {
+		customParam("customParam", CustomStruct()),
+		listParam("listParam", std::vector<int>()) {
 		SC_THREAD(example);
 	}
 private:
@@ -34,11 +38,13 @@ private:
 		HV_LOG_INFO("ConfigModule.intParam = 0x{:x}", intParam);
 		HV_LOG_INFO("ConfigModule.mapParam.message = {}", customParam.getValue().message);
 		HV_LOG_INFO("ConfigModule.mapParam.size = {}", customParam.getValue().size);
+		HV_LOG_INFO("ConfigModule.listParam size = {}", listParam.getValue().size());
 	}
 
 private:
 	hv::cfg::Param<int> intParam;
 	hv::cfg::Param<CustomStruct> customParam;
+	hv::cfg::Param<std::vector<int> > listParam;
 };
 
 int sc_main(int argc, char* argv[])
@@ -64,29 +70,3 @@ int sc_main(int argc, char* argv[])
 
 	return EXIT_SUCCESS;
 }
-
-namespace cci {
-template<> struct cci_value_converter<CustomStruct> {
-	typedef CustomStruct type;
-
-	static bool pack(cci_value::reference dst, type const& src) {
-		cci_value_map_ref mref(dst.set_map());
-		mref.push_entry("message", src.message);
-		mref.push_entry("size", src.size);
-		return true;
-	}
-
-	static bool unpack(type & dst, cci_value::const_reference src) {
-		if (!src.is_map()) {
-			return false;
-		}
-		cci_value::const_map_reference m = src.get_map();
-		if (m.has_entry("message") && m.at("message").try_get(dst.message)
-		&& m.has_entry("size") && m.at("size").try_get(dst.size) ) {
-			return true;
-		}
-		return false;
-	}
-};
-}
-
@@ -7,13 +7,20 @@
  * @brief Base broker implementaton
  */
 
+#include "../../checkpoint/checkpoint.h"
+#include "../../profiler/profiler.h"
 #include "../../storage/memory/memory.h"
 #include "broker-base.h"
 
+#include <algorithm>
+#include <fstream>
+#include <iterator>
+#include <utility>
+
 HV_CONFIGURATION_OPEN_NAMESPACE
 
 BrokerBase::BrokerBase(const std::string& name, StorageIf* storage) :
-	name(name), deleteStorage(false) {
+	name(name), params(), presets(storage), deleteStorage(false), dirtyParams(), checkpointId(0), valueArena() {
 	if(storage == nullptr) {
 		this->presets = new Memory();
 		this->deleteStorage = true;
@@ -80,16 +87,28 @@ bool BrokerBase::hasPresetValue(const std::string& paramName) const {
 
 void BrokerBase::addParam(ParamIf* paramBase) {
 	if(paramBase) {
+		HV_CFG_PROFILE_SCOPE(PROFILE_PARAM_REGISTRATION);
 		HV_LOG_TRACE("Broker adding param {}", paramBase->getName());
 		params[paramBase->getName()] = paramBase;
+		HV_CFG_PROFILE_BYTES(sizeof(*params.begin()) + paramBase->getName().capacity());
 	}
 }
 
 void BrokerBase::removeParam(ParamIf* paramBase) {
 	if(paramBase) {
-		std::string paramName = paramBase->getName();
-		if(hasParam(paramName)) {
-			params.erase(paramName);
+		// Another parameter may have been registered under the same name
+		auto it = params.find(paramBase->getName());
+		if(it != params.end() && it->second == paramBase) {
+			params.erase(it);
+		}
+		if(paramBase->isDirty()) {
+			// Swap with the last entry: the dirty list is unordered
+			std::size_t index = paramBase->getDirtyIndex();
+			if(index < dirtyParams.size() && dirtyParams[index] == paramBase) {
+				dirtyParams[index] = dirtyParams.back();
+				dirtyParams[index]->setDirtyIndex(index);
+				dirtyParams.pop_back();
+			}
 		}
 	}
 }
@@ -114,8 +133,307 @@ bool BrokerBase::hasParam(const std::string& paramName) const {
 	return params.find(paramName) != params.end();
 }
 
+bool BrokerBase::checkpoint(std::ostream& stream) {
+	return writeCheckpoint(stream, false);
+}
+
+bool BrokerBase::checkpointDelta(std::ostream& stream) {
+	return writeCheckpoint(stream, true);
+}
+
+bool BrokerBase::writeCheckpoint(std::ostream& stream, bool delta) {
+	const std::uint64_t parentId = delta ? checkpointId : 0;
+	const std::size_t count = delta ? dirtyParams.size() : params.size();
+
+	CheckpointWriter writer;
+	writer.writeRaw(HV_CONFIGURATION_CHECKPOINT_MAGIC, sizeof(HV_CONFIGURATION_CHECKPOINT_MAGIC) - 1);
+	writer.write(static_cast<std::uint32_t>(HV_CONFIGURATION_CHECKPOINT_VERSION));
+	writer.write(static_cast<std::uint8_t>(delta));
+	writer.write(static_cast<std::uint64_t>(checkpointId + 1));
+	writer.write(parentId);
+	writer.write(static_cast<std::uint64_t>(count));
+	if(delta) {
+		for(auto const &param : dirtyParams) {
+			writer.writeString(param->getName());
+			std::size_t block = writer.beginBlock();
+			param->saveState(writer);
+			writer.endBlock(block);
+		}
+	} else {
+		for(auto const &entry : params) {
+			writer.writeString(entry.first);
+			std::size_t block = writer.beginBlock();
+			entry.second->saveState(writer);
+			writer.endBlock(block);
+		}
+	}
+	HV_LOG_DEBUG("Checkpoint {} of {} parameters ({} bytes)", checkpointId + 1, count, writer.size());
+	if(!writer.flush(stream)) {
+		HV_LOG_ERROR("Unable to write checkpoint {}", checkpointId + 1);
+		return false;
+	}
+
+	++checkpointId;
+	if(!delta) {
+		// Parameters created before a broker was available are not tracked
+		for(auto const &entry : params) {
+			entry.second->clearDirty();
+		}
+	}
+	clearDirtyParams();
+	return true;
+}
+
+void BrokerBase::clearDirtyParams() {
+	for(auto const &param : dirtyParams) {
+		param->clearDirty();
+	}
+	dirtyParams.clear();
+}
+
+bool BrokerBase::restore(std::istream& stream) {
+	std::string data((std::istreambuf_iterator<char>(stream)), std::istreambuf_iterator<char>());
+	CheckpointReader reader(data.data(), data.size());
+
+	char magic[sizeof(HV_CONFIGURATION_CHECKPOINT_MAGIC) - 1];
+	std::uint32_t version;
+	std::uint8_t delta;
+	std::uint64_t id;
+	std::uint64_t parentId;
+	std::uint64_t count;
+	if(!reader.readRaw(magic, sizeof(magic))
+			|| std::string(magic, sizeof(magic)) != HV_CONFIGURATION_CHECKPOINT_MAGIC
+			|| !reader.read(version) || version != HV_CONFIGURATION_CHECKPOINT_VERSION
+			|| !reader.read(delta) || !reader.read(id) || !reader.read(parentId)
+			|| !reader.read(count)) {
+		HV_LOG_ERROR("Invalid checkpoint header");
+		return false;
+	}
+	if(delta && parentId != checkpointId) {
+		HV_LOG_ERROR("Checkpoint {} applies on checkpoint {}, current state is checkpoint {}",
+				id, parentId, checkpointId);
+		return false;
+	}
+
+	bool result = true;
+	for(std::uint64_t i = 0; i < count; ++i) {
+		std::string paramName;
+		CheckpointReader block(nullptr, 0);
+		if(!reader.readString(paramName) || !reader.readBlock(block)) {
+			HV_LOG_ERROR("Truncated checkpoint");
+			return false;
+		}
+		auto it = params.find(paramName);
+		if(it == params.end()) {
+			HV_LOG_WARNING("Checkpoint parameter {} is not registered, skipped", paramName);
+			continue;
+		}
+		if(!it->second->restoreState(block)) {
+			HV_LOG_ERROR("Unable to restore parameter {}", paramName);
+			result = false;
+		}
+	}
+
+	checkpointId = id;
+	clearDirtyParams();
+	return result;
+}
+
+std::uint64_t BrokerBase::getCheckpointId() const {
+	return checkpointId;
+}
+
+bool BrokerBase::exportParams(std::ostream& stream, const ExportOptions& options) const {
+	Exporter exporter(stream, options);
+	for(auto const &param : params) {
+		if(options.nonDefaultOnly && param.second->isDefaultValue()) {
+			continue;
+		}
+		if(options.presetOnly && !hasPresetValue(param.first)) {
+			continue;
+		}
+		exporter.beginParam(param.first);
+		param.second->exportParam(exporter);
+		exporter.endParam();
+	}
+	return exporter.finish();
+}
+
+bool BrokerBase::exportParams(const std::string& filepath, const ExportOptions& options) const {
+	std::ofstream stream;
+	// The exporter writes large chunks: let them go straight to the file
+	stream.rdbuf()->pubsetbuf(nullptr, 0);
+	stream.open(filepath.c_str(), std::ios::binary | std::ios::trunc);
+	if(!stream) {
+		HV_LOG_ERROR("Unable to open {}", filepath);
+		return false;
+	}
+	bool result = exportParams(stream, options);
+	stream.close();
+	return result && !stream.fail();
+}
+
+void BrokerBase::markParamDirty(ParamIf* param) {
+	param->setDirtyIndex(dirtyParams.size());
+	dirtyParams.push_back(param);
+}
+
+void BrokerBase::enableValueArena() {
+	if(!valueArena) {
+		valueArena.reset(new ValueArena());
+	}
+}
+
+ValueArena* BrokerBase::getValueArena() const {
+	return valueArena.get();
+}
+
+ValueArena::Snapshot BrokerBase::takeValueSnapshot() const {
+	return valueArena ? valueArena->takeSnapshot() : ValueArena::Snapshot();
+}
+
+bool BrokerBase::restoreValueSnapshot(const ValueArena::Snapshot& snapshot) {
+	if(!valueArena) {
+		return false;
+	}
+	std::vector<ParamIf*> changed;
+	if(!valueArena->restoreSnapshot(snapshot, changed)) {
+		return false;
+	}
+	for(ParamIf* param : changed) {
+		param->markDirty();
+	}
+	return true;
+}
+
+ConfigSnapshot BrokerBase::takeSnapshot() const {
+	ConfigSnapshot snapshot;
+	if(valueArena) {
+		snapshot.arena = valueArena.get();
+		snapshot.arenaValues = valueArena->takeSnapshot();
+	}
+	snapshot.entries.reserve(params.size());
+	for(auto const &entry : params) {
+		if(entry.second->isInValueArena()) {
+			snapshot.arenaCount++;
+			continue;
+		}
+		ConfigSnapshot::Entry snapshotEntry;
+		snapshotEntry.name = entry.first;
+		snapshotEntry.param = entry.second;
+		snapshotEntry.value.reset(entry.second->copyValue());
+		snapshot.indexes[entry.second] = snapshot.entries.size();
+		snapshot.entries.push_back(std::move(snapshotEntry));
+	}
+	return snapshot;
+}
+
+bool BrokerBase::resetAll(ResetMode mode, ResetPolicy policy, const ConfigSnapshot* snapshot) {
+	if(mode == RESET_SNAPSHOT && !snapshot) {
+		HV_LOG_ERROR("No snapshot to reset to");
+		return false;
+	}
+
+	bool result = true;
+	bool arenaReset = false;
+	if(valueArena && mode != RESET_PRESET) {
+		// Callbacks need the previous value: only compare, values are written one by one
+		const bool apply = policy == RESET_SKIP_CALLBACKS;
+		std::vector<ParamIf*> changed;
+		if(mode == RESET_DEFAULT) {
+			valueArena->resetToDefaults(changed, apply);
+			arenaReset = true;
+		} else if(snapshot->arena == valueArena.get()) {
+			arenaReset = valueArena->restoreSnapshot(snapshot->arenaValues, changed, apply);
+		}
+		for(ParamIf* param : changed) {
+			if(apply) {
+				param->markDirty();
+			} else if(!param->resetValue(mode, policy, snapshot)) {
+				HV_LOG_WARNING("Unable to reset parameter {}", param->getName());
+				result = false;
+			}
+		}
+	}
+
+	for(auto const &entry : params) {
+		if(arenaReset && entry.second->isInValueArena()) {
+			continue;
+		}
+		if(!entry.second->resetValue(mode, policy, snapshot)) {
+			HV_LOG_WARNING("Unable to reset parameter {}", entry.first);
+			result = false;
+		}
+	}
+	return result;
+}
+
+bool BrokerBase::diff(const ConfigSnapshot& before, const ConfigSnapshot& after, ConfigDiff& result) const {
+	std::vector<ConfigDifference>& differences = result.differences;
+	differences.clear();
+
+	bool complete = true;
+	if(before.arena || after.arena) {
+		std::vector<ParamIf*> changed;
+		if(before.arena == valueArena.get() && after.arena == valueArena.get()
+				&& valueArena->compareSnapshots(before.arenaValues, after.arenaValues, changed)) {
+			for(ParamIf* param : changed) {
+				ConfigDifference difference;
+				difference.name = param->getName();
+				difference.before = param->getSnapshotCCIValue(before);
+				difference.after = param->getSnapshotCCIValue(after);
+				differences.push_back(std::move(difference));
+			}
+		} else {
+			HV_LOG_ERROR("Unable to compare arena values of snapshots taken with other parameters");
+			complete = false;
+		}
+	}
+	const std::size_t arenaDifferences = differences.size();
+
+	// Other values are in name order: parameters missing from a snapshot have a null value
+	auto first = before.entries.begin();
+	auto second = after.entries.begin();
+	while(first != before.entries.end() || second != after.entries.end()) {
+		const int order = first == before.entries.end() ? 1 :
+				second == after.entries.end() ? -1 : first->name.compare(second->name);
+		if(order == 0 && first->value->equals(*second->value)) {
+			++first;
+			++second;
+			continue;
+		}
+		ConfigDifference difference;
+		if(order <= 0) {
+			difference.name = first->name;
+			difference.before = first->value->toCCIValue();
+			++first;
+		}
+		if(order >= 0) {
+			difference.name = second->name;
+			difference.after = second->value->toCCIValue();
+			++second;
+		}
+		differences.push_back(std::move(difference));
+	}
+
+	if(arenaDifferences) {
+		auto byName = [](const ConfigDifference& a, const ConfigDifference& b) {
+			return a.name < b.name;
+		};
+		std::sort(differences.begin(), differences.begin() + arenaDifferences, byName);
+		std::inplace_merge(differences.begin(), differences.begin() + arenaDifferences, differences.end(), byName);
+	}
+	return complete;
+}
+
+bool BrokerBase::diff(const ConfigSnapshot& before, ConfigDiff& result) const {
+	return diff(before, takeSnapshot(), result);
+}
 
 BrokerBase::~BrokerBase() {
+	for(auto const &param : params) {
+		param.second->detachBroker();
+	}
 	if(deleteStorage) {
 		delete presets;
 	}
@@ -10,10 +10,16 @@
 #ifndef HV_CONFIGURATION_BROKER_BASE_H
 #define HV_CONFIGURATION_BROKER_BASE_H
 
+#include <cstdint>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 #include "../../configuration/common.h"
+#include "../../configuration/value-arena.h"
+#include "../../checkpoint/config-diff.h"
+#include "../../checkpoint/config-snapshot.h"
+#include "../../exporter/exporter.h"
 #include "../../storage/memory/memory.h"
 #include "../../storage/storage-if.h"
 #include "../../param/base/param-base.h"
@@ -142,6 +148,157 @@ public:
 	 */
 	virtual ParamIf* getParam(const std::string& paramName);
 
+	/**
+	 * Write the state of all registered parameters into a binary checkpoint
+	 *
+	 * The checkpoint becomes the base of the following delta checkpoints.
+	 *
+	 * @param stream Output stream
+	 * @return True if successful, otherwise False
+	 */
+	virtual bool checkpoint(std::ostream& stream);
+
+	/**
+	 * Write the parameters modified since the previous checkpoint
+	 *
+	 * The delta is chained to the previous checkpoint, full or delta.
+	 *
+	 * @param stream Output stream
+	 * @return True if successful, otherwise False
+	 */
+	virtual bool checkpointDelta(std::ostream& stream);
+
+	/**
+	 * Restore parameters from a binary checkpoint
+	 *
+	 * Restore the base checkpoint first, then replay its deltas in order: a
+	 * delta is rejected if it does not follow the latest restored checkpoint.
+	 * Values are written back directly: callbacks are not run. Parameters
+	 * missing from the broker are skipped.
+	 *
+	 * @param stream Input stream
+	 * @return True if successful, otherwise False
+	 */
+	virtual bool restore(std::istream& stream);
+
+	/**
+	 * Get the ID of the checkpoint the current state derives from
+	 *
+	 * @return Checkpoint ID, 0 if there is none
+	 */
+	std::uint64_t getCheckpointId() const;
+
+	/**
+	 * Track a parameter modified since the previous checkpoint
+	 *
+	 * @param param Modified parameter
+	 */
+	virtual void markParamDirty(ParamIf* param);
+
+	/**
+	 * Store the values of bool, integral and floating point parameters
+	 * created from now on in a value arena
+	 *
+	 * Broker-wide value operations become linear scans over contiguous
+	 * arrays. The arena is kept until the broker is destroyed, at which point
+	 * the remaining parameters take their value back.
+	 */
+	void enableValueArena();
+
+	/**
+	 * Get the value arena
+	 *
+	 * @return Value arena, null if disabled
+	 */
+	ValueArena* getValueArena() const;
+
+	/**
+	 * Copy the values of all arena parameters
+	 *
+	 * @return Snapshot, empty if the value arena is disabled
+	 */
+	ValueArena::Snapshot takeValueSnapshot() const;
+
+	/**
+	 * Restore the values of all arena parameters
+	 *
+	 * Values are written back directly, as with restore(): callbacks are not
+	 * run. Modified parameters are flagged as dirty.
+	 *
+	 * @param snapshot Snapshot taken while the same parameters existed
+	 * @return True if successful, otherwise False
+	 */
+	bool restoreValueSnapshot(const ValueArena::Snapshot& snapshot);
+
+	/**
+	 * Copy the values of all registered parameters
+	 *
+	 * @return Snapshot
+	 */
+	ConfigSnapshot takeSnapshot() const;
+
+	/**
+	 * Reset all registered parameters in one pass
+	 *
+	 * Only values differing from their target are written. Arena values are
+	 * compared, and with RESET_SKIP_CALLBACKS restored, by block; presets
+	 * are not stored in the arena, so RESET_PRESET goes through each
+	 * parameter.
+	 *
+	 * @param mode Value to reset to
+	 * @param policy Callback handling
+	 * @param snapshot Baseline snapshot, for RESET_SNAPSHOT
+	 * @return True if all parameters were reset, otherwise False
+	 */
+	bool resetAll(ResetMode mode = RESET_DEFAULT, ResetPolicy policy = RESET_RUN_CALLBACKS,
+			const ConfigSnapshot* snapshot = nullptr);
+
+	/**
+	 * List the parameters whose value differs between two snapshots
+	 *
+	 * Arena values are compared by block and only mismatching values are
+	 * converted to CCI values. Arena values can only be compared while the
+	 * parameters of both snapshots exist; otherwise they are skipped and
+	 * the diff is incomplete.
+	 *
+	 * @param before First snapshot
+	 * @param after Second snapshot
+	 * @param result Differences
+	 * @return True if the diff is complete, otherwise False
+	 */
+	bool diff(const ConfigSnapshot& before, const ConfigSnapshot& after, ConfigDiff& result) const;
+
+	/**
+	 * List the parameters whose value differs between a snapshot and the
+	 * current values
+	 *
+	 * @param before Snapshot
+	 * @param result Differences
+	 * @return True if the diff is complete, otherwise False
+	 */
+	bool diff(const ConfigSnapshot& before, ConfigDiff& result) const;
+
+	/**
+	 * Stream all registered parameters as a nested YAML or JSON document
+	 *
+	 * Parameters are walked in name order and written through a buffered
+	 * writer: memory use does not depend on the number of parameters.
+	 *
+	 * @param stream Output stream
+	 * @param options Export options
+	 * @return True if successful, otherwise False
+	 */
+	bool exportParams(std::ostream& stream, const ExportOptions& options = ExportOptions()) const;
+
+	/**
+	 * Stream all registered parameters into a file
+	 *
+	 * @param filepath Output file path, truncated if it exists
+	 * @param options Export options
+	 * @return True if successful, otherwise False
+	 */
+	bool exportParams(const std::string& filepath, const ExportOptions& options = ExportOptions()) const;
+
 	/**
 	 * Destructor
      */
@@ -168,6 +325,20 @@ protected:
 
 	/// Wether storage should be removed
 	bool deleteStorage;
+
+	/// Parameters modified since the previous checkpoint
+	std::vector<ParamIf*> dirtyParams;
+
+	/// Checkpoint the current state derives from
+	std::uint64_t checkpointId;
+
+	/// Scalar parameter values, null if disabled
+	std::unique_ptr<ValueArena> valueArena;
+
+private:
+	bool writeCheckpoint(std::ostream& stream, bool delta);
+
+	void clearDirtyParams();
 };
 
 HV_CONFIGURATION_CLOSE_NAMESPACE
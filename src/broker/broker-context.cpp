@@ -0,0 +1,22 @@
+/*
+ * @file broker-context.cpp
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Thread broker binding
+ */
+
+#include "broker-context.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+BrokerContext::BrokerContext(Broker& broker) : previous(_getThreadBroker()) {
+	_setThreadBroker(&broker);
+}
+
+BrokerContext::~BrokerContext() {
+	_setThreadBroker(previous);
+}
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
@@ -0,0 +1,47 @@
+/*
+ * @file broker-context.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Thread broker binding
+ */
+
+#ifndef HV_CONFIGURATION_BROKER_CONTEXT_H
+#define HV_CONFIGURATION_BROKER_CONTEXT_H
+
+#include "../configuration/common.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+/**
+ * Broker context
+ *
+ * Binds a broker to the current thread for the lifetime of the context:
+ * parameters created meanwhile are registered into this broker. The previous
+ * binding is restored on destruction. Threads without a bound broker use the
+ * first broker created, so independent models elaborated in parallel threads
+ * each bind their own broker explicitly.
+ */
+class BrokerContext {
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param broker Broker to bind to the current thread
+	 */
+	explicit BrokerContext(Broker& broker);
+
+	~BrokerContext();
+
+	BrokerContext(const BrokerContext&) HV_CPLUSPLUS_MEMBER_FUNCTION_DELETE;
+	BrokerContext& operator=(const BrokerContext&) HV_CPLUSPLUS_MEMBER_FUNCTION_DELETE;
+
+private:
+	/// Broker previously bound to the thread
+	Broker* previous;
+};
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_BROKER_CONTEXT_H
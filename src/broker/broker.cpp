@@ -31,6 +31,10 @@ Broker::Broker(const std::string& name,
 	return brokerCCI;
 }
 
+bool Broker::hasPresetValue(const std::string& paramName) const {
+	return brokerCCI.has_preset_value(paramName);
+}
+
 Broker::operator ::cci::cci_broker_if*() {
 	return &brokerCCI;
 }
@@ -40,7 +44,7 @@ Broker::operator ::cci::cci_broker_if& () {
 }
 
 Broker::~Broker() {
-	_unregisterGlobalBroker();
+	_unregisterGlobalBroker(this);
 }
 
 HV_CONFIGURATION_CLOSE_NAMESPACE
@@ -12,6 +12,7 @@
 
 #include "../configuration/common.h"
 #include "base/broker-base.h"
+#include "broker-context.h"
 #include "cci/broker-cci.h"
 
 HV_CONFIGURATION_OPEN_NAMESPACE
@@ -32,6 +33,9 @@ public:
 
 	::cci::cci_broker_if& getCCIBroker();
 
+	/// Presets are held by the CCI broker
+	bool hasPresetValue(const std::string& paramName) const override;
+
 private:
 	BrokerCCI brokerCCI;
 };
@@ -12,16 +12,14 @@
 
 #include "broker-cci.h"
 #include "../../configuration/common.h"
-
-#define HV_BROKER_CCI_USED_PRESETS_PREFIX "used-presets."
-#define HV_BROKER_CCI_LOCKED_PRESETS_PREFIX "locked-presets."
+#include "../../profiler/profiler.h"
 
 HV_CONFIGURATION_OPEN_NAMESPACE
 
 BrokerCCI::BrokerCCI(BrokerBase& brokerBase,
 		StorageIf* storage,
 		bool registerCCI) :
-	brokerBase(brokerBase), params(), presetOriginators(),
+	brokerBase(brokerBase), params(), presetOriginators(), usedPresets(), lockedPresets(),
 	createCallbacks(), destroyCallbacks(), ignoredUnconsumedPredicates() {
 	if(!storage) {
 		deleteStorage = true;
@@ -104,6 +102,11 @@ void BrokerCCI::set_preset_cci_value(
 	}
 	setCCIPreset(paramName, cciValue);
 	setCCIPresetOriginator(paramName, originator);
+
+	PresetListenerIf* listener = dynamic_cast<PresetListenerIf*>(getCCIParam(paramName));
+	if(listener) {
+		listener->presetChanged(cciValue);
+	}
 }
 
 ::cci::cci_value BrokerCCI::get_preset_cci_value(const std::string& paramName) const {
@@ -173,8 +176,9 @@ void BrokerCCI::ignore_unconsumed_preset_values(const ::cci::cci_preset_value_pr
 
 bool BrokerCCI::unregister_create_callback(const ::cci::cci_param_create_callback_handle& callback,
 		const ::cci::cci_originator& originator) {
+	const OriginatorId originatorId = internOriginator(originator);
 	for (auto it = createCallbacks.begin(); it != createCallbacks.end(); ++it) {
-		if (it->callback == callback && it->originator == originator) {
+		if (it->callback == callback && it->originatorId == originatorId) {
 			createCallbacks.erase(it);
 			return true;
 		}
@@ -191,8 +195,9 @@ bool BrokerCCI::unregister_create_callback(const ::cci::cci_param_create_callbac
 
 bool BrokerCCI::unregister_destroy_callback(const ::cci::cci_param_destroy_callback_handle& callback,
 		const ::cci::cci_originator& originator) {
+	const OriginatorId originatorId = internOriginator(originator);
 	for (auto it = destroyCallbacks.begin(); it != destroyCallbacks.end(); ++it) {
-		if (it->callback == callback && it->originator == originator) {
+		if (it->callback == callback && it->originatorId == originatorId) {
 			destroyCallbacks.erase(it);
 			return true;
 		}
@@ -212,6 +217,7 @@ bool BrokerCCI::has_callbacks() const {
 }
 
 void BrokerCCI::add_param(::cci::cci_param_if* param) {
+	HV_CFG_PROFILE_SCOPE(PROFILE_CCI_REGISTRATION);
 	if(param) {
 		if(!hasCCIParam(param->name())) {
 			setCCIParam(param);
@@ -257,32 +263,28 @@ void BrokerCCI::remove_param(::cci::cci_param_if* param) {
 
 // ---------------------------------------------------
 
-void BrokerCCI::setCCIPresetLocked(const std::string& paramName) const {
-	std::string paramKey = HV_BROKER_CCI_LOCKED_PRESETS_PREFIX + paramName;
-	presets->setValue(paramKey, "1");
+void BrokerCCI::setCCIPresetLocked(const std::string& paramName) {
+	lockedPresets.insert(paramName);
 }
 
 bool BrokerCCI::isCCIPresetLocked(const std::string& paramName) const {
-	std::string paramKey = HV_BROKER_CCI_LOCKED_PRESETS_PREFIX + paramName;
-	return presets->hasValue(paramKey);
+	return lockedPresets.find(paramName) != lockedPresets.end();
 }
 
-void BrokerCCI::setCCIPresetUsed(const std::string& paramName, bool used) const {
-	std::string paramKey = HV_BROKER_CCI_USED_PRESETS_PREFIX + paramName;
-	presets->setValue(paramKey, std::to_string(static_cast<unsigned int>(used)));
+void BrokerCCI::setCCIPresetUsed(const std::string& paramName, bool used) {
+	usedPresets[paramName] = used;
 }
 
 bool BrokerCCI::isCCIPresetUsed(const std::string& paramName) const {
-	std::string paramKey = HV_BROKER_CCI_USED_PRESETS_PREFIX + paramName;
-	return presets->getValue(paramKey) == "1";
+	auto it = usedPresets.find(paramName);
+	return it != usedPresets.end() && it->second;
 }
 
 std::vector<std::string> BrokerCCI::getCCIPresetUsed(bool used) const {
-	std::map<std::string, std::string> usedPresets = presets->getValues(HV_BROKER_CCI_USED_PRESETS_PREFIX);
 	std::vector<std::string> result;
 	for (auto &entry : usedPresets) {
-		if (entry.second == std::to_string(static_cast<unsigned int>(used))) {
-			result.push_back(entry.first.substr(entry.first.find(HV_BROKER_CCI_USED_PRESETS_PREFIX) + 1));
+		if (entry.second == used) {
+			result.push_back(entry.first);
 		}
 	}
 	return result;
@@ -293,15 +295,11 @@ bool BrokerCCI::hasCCIPreset(const std::string& paramName) const {
 }
 
 ::cci::cci_value BrokerCCI::getCCIPreset(const std::string& paramName) const {
-	if(presets->hasValue(paramName)) {
-		return ::cci::cci_value::from_json(presets->getValue(paramName));
-	} else {
-		return ::cci::cci_value();
-	}
+	return presets->getCCIValue(paramName);
 }
 
 void BrokerCCI::setCCIPreset(const std::string& paramName, const ::cci::cci_value& value) {
-	presets->setValue(paramName, value.to_json());
+	presets->setCCIValue(paramName, value);
 	setCCIPresetUsed(paramName, 0);
 }
 
@@ -311,16 +309,16 @@ void BrokerCCI::setCCIPreset(const std::string& paramName, const ::cci::cci_valu
 // ----------------------------
 
 ::cci::cci_originator BrokerCCI::getCCIPresetOriginator(const std::string& paramName) const {
-	if(hasCCIPresetOriginator(paramName)) {
-		return presetOriginators.at(paramName);
+	auto it = presetOriginators.find(paramName);
+	if(it != presetOriginators.end()) {
+		return getOriginator(it->second);
 	} else {
 		return ::cci::cci_originator();
 	}
 }
 
 void BrokerCCI::setCCIPresetOriginator(const std::string& paramName, const ::cci::cci_originator& originator) {
-	presetOriginators.insert(std::pair<std::string, const ::cci::cci_originator&>(paramName, originator));
-
+	presetOriginators[paramName] = internOriginator(originator);
 }
 
 bool BrokerCCI::hasCCIPresetOriginator(const std::string& paramName) const {
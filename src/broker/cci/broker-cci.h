@@ -10,6 +10,11 @@
 #ifndef HV_CONFIGURATION_BROKER_CCI_H
 #define HV_CONFIGURATION_BROKER_CCI_H
 
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
 #include "../../configuration/common.h"
 #include "../../storage/storage-if.h"
 #include "../base/broker-base.h"
@@ -154,11 +159,11 @@ private:
 
 	bool hasCCIPreset(const std::string& paramName) const;
 
-	void setCCIPresetUsed(const std::string& paramName, bool used) const;
+	void setCCIPresetUsed(const std::string& paramName, bool used);
 
 	bool isCCIPresetUsed(const std::string& paramName) const;
 
-	void setCCIPresetLocked(const std::string& paramName) const;
+	void setCCIPresetLocked(const std::string& paramName);
 
 	bool isCCIPresetLocked(const std::string& paramName) const;
 
@@ -183,8 +188,14 @@ private:
 	/// Wether presets should be removed
 	bool deleteStorage;
 
-	/// Preset originators
-	std::map<std::string, ::cci::cci_originator> presetOriginators;
+	/// Preset originators (interned)
+	std::map<std::string, OriginatorId> presetOriginators;
+
+	/// Whether the preset of each known parameter name has been used, kept out of the preset storage
+	std::map<std::string, bool> usedPresets;
+
+	/// Locked presets
+	std::set<std::string> lockedPresets;
 
 	/// Create callbacks
 	std::vector<CCICallbackObject<::cci::cci_param_create_callback_handle::type> > createCallbacks;
@@ -0,0 +1,238 @@
+/*
+ * @file checkpoint.cpp
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Binary checkpoint format
+ */
+
+#include "checkpoint.h"
+
+#include <cstring>
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+/// CCI value tags
+enum CheckpointValueTag : std::uint8_t {
+	CHECKPOINT_NULL,
+	CHECKPOINT_FALSE,
+	CHECKPOINT_TRUE,
+	CHECKPOINT_INT64,
+	CHECKPOINT_UINT64,
+	CHECKPOINT_DOUBLE,
+	CHECKPOINT_STRING,
+	CHECKPOINT_LIST,
+	CHECKPOINT_MAP
+};
+
+CheckpointWriter::CheckpointWriter() : buffer() {
+}
+
+void CheckpointWriter::writeRaw(const void* data, std::size_t size) {
+	const char* bytes = static_cast<const char*>(data);
+	buffer.insert(buffer.end(), bytes, bytes + size);
+}
+
+void CheckpointWriter::writeString(const std::string& str) {
+	write(static_cast<std::uint32_t>(str.size()));
+	writeRaw(str.data(), str.size());
+}
+
+void CheckpointWriter::writeValue(::cci::cci_value::const_reference value) {
+	switch(value.category()) {
+	case ::cci::CCI_BOOL_VALUE:
+		write(static_cast<std::uint8_t>(value.get_bool() ? CHECKPOINT_TRUE : CHECKPOINT_FALSE));
+		break;
+	case ::cci::CCI_INTEGRAL_VALUE:
+		if(value.is_int64()) {
+			write(static_cast<std::uint8_t>(CHECKPOINT_INT64));
+			write(value.get_int64());
+		} else {
+			write(static_cast<std::uint8_t>(CHECKPOINT_UINT64));
+			write(value.get_uint64());
+		}
+		break;
+	case ::cci::CCI_REAL_VALUE:
+		write(static_cast<std::uint8_t>(CHECKPOINT_DOUBLE));
+		write(value.get_double());
+		break;
+	case ::cci::CCI_STRING_VALUE: {
+		::cci::cci_value_string_cref str = value.get_string();
+		write(static_cast<std::uint8_t>(CHECKPOINT_STRING));
+		write(static_cast<std::uint32_t>(str.size()));
+		writeRaw(str.c_str(), str.size());
+		break;
+	}
+	case ::cci::CCI_LIST_VALUE: {
+		::cci::cci_value_list_cref list = value.get_list();
+		write(static_cast<std::uint8_t>(CHECKPOINT_LIST));
+		write(static_cast<std::uint32_t>(list.size()));
+		for(std::size_t i = 0; i < list.size(); ++i) {
+			writeValue(list[i]);
+		}
+		break;
+	}
+	case ::cci::CCI_MAP_VALUE: {
+		::cci::cci_value_map_cref map = value.get_map();
+		write(static_cast<std::uint8_t>(CHECKPOINT_MAP));
+		write(static_cast<std::uint32_t>(map.size()));
+		for(auto const &entry : map) {
+			writeString(entry.key);
+			writeValue(entry.value);
+		}
+		break;
+	}
+	case ::cci::CCI_NULL_VALUE:
+	case ::cci::CCI_OTHER_VALUE:
+	default:
+		write(static_cast<std::uint8_t>(CHECKPOINT_NULL));
+		break;
+	}
+}
+
+std::size_t CheckpointWriter::beginBlock() {
+	std::size_t offset = buffer.size();
+	write(static_cast<std::uint32_t>(0));
+	return offset;
+}
+
+void CheckpointWriter::endBlock(std::size_t offset) {
+	std::uint32_t blockSize = static_cast<std::uint32_t>(buffer.size() - offset - sizeof(std::uint32_t));
+	std::memcpy(&buffer[offset], &blockSize, sizeof(blockSize));
+}
+
+std::size_t CheckpointWriter::size() const {
+	return buffer.size();
+}
+
+bool CheckpointWriter::flush(std::ostream& stream) {
+	stream.write(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+	buffer.clear();
+	return static_cast<bool>(stream);
+}
+
+CheckpointReader::CheckpointReader(const char* data, std::size_t size) :
+		data(data), size(size), offset(0) {
+}
+
+bool CheckpointReader::readRaw(void* destination, std::size_t length) {
+	if(length > size - offset) {
+		return false;
+	}
+	std::memcpy(destination, data + offset, length);
+	offset += length;
+	return true;
+}
+
+bool CheckpointReader::readString(std::string& str) {
+	std::uint32_t length;
+	if(!read(length) || length > size - offset) {
+		return false;
+	}
+	str.assign(data + offset, length);
+	offset += length;
+	return true;
+}
+
+bool CheckpointReader::readValue(::cci::cci_value& value) {
+	std::uint8_t tag;
+	if(!read(tag)) {
+		return false;
+	}
+	switch(tag) {
+	case CHECKPOINT_NULL:
+		value.set_null();
+		return true;
+	case CHECKPOINT_FALSE:
+	case CHECKPOINT_TRUE:
+		value.set_bool(tag == CHECKPOINT_TRUE);
+		return true;
+	case CHECKPOINT_INT64: {
+		std::int64_t integer;
+		if(!read(integer)) {
+			return false;
+		}
+		value.set_int64(integer);
+		return true;
+	}
+	case CHECKPOINT_UINT64: {
+		std::uint64_t integer;
+		if(!read(integer)) {
+			return false;
+		}
+		value.set_uint64(integer);
+		return true;
+	}
+	case CHECKPOINT_DOUBLE: {
+		double real;
+		if(!read(real)) {
+			return false;
+		}
+		value.set_double(real);
+		return true;
+	}
+	case CHECKPOINT_STRING: {
+		std::string str;
+		if(!readString(str)) {
+			return false;
+		}
+		value.set_string(str);
+		return true;
+	}
+	case CHECKPOINT_LIST: {
+		std::uint32_t count;
+		if(!read(count)) {
+			return false;
+		}
+		::cci::cci_value_list_ref list = value.set_list();
+		for(std::uint32_t i = 0; i < count; ++i) {
+			::cci::cci_value item;
+			if(!readValue(item)) {
+				return false;
+			}
+			list.push_back(item);
+		}
+		return true;
+	}
+	case CHECKPOINT_MAP: {
+		std::uint32_t count;
+		if(!read(count)) {
+			return false;
+		}
+		::cci::cci_value_map_ref map = value.set_map();
+		for(std::uint32_t i = 0; i < count; ++i) {
+			std::string key;
+			::cci::cci_value item;
+			if(!readString(key) || !readValue(item)) {
+				return false;
+			}
+			map.push_entry(key, item);
+		}
+		return true;
+	}
+	default:
+		HV_LOG_ERROR("Unknown checkpoint value tag {}", static_cast<unsigned int>(tag));
+		return false;
+	}
+}
+
+bool CheckpointReader::readBlock(CheckpointReader& block) {
+	std::uint32_t length;
+	if(!read(length) || length > size - offset) {
+		return false;
+	}
+	block = CheckpointReader(data + offset, length);
+	offset += length;
+	return true;
+}
+
+bool CheckpointReader::atEnd() const {
+	return offset == size;
+}
+
+std::size_t CheckpointReader::remaining() const {
+	return size - offset;
+}
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
@@ -0,0 +1,195 @@
+/*
+ * @file checkpoint.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Binary checkpoint format
+ */
+
+#ifndef HV_CONFIGURATION_CHECKPOINT_H
+#define HV_CONFIGURATION_CHECKPOINT_H
+
+#include "../configuration/common.h"
+
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <cci_configuration>
+
+/// Checkpoint file magic
+#define HV_CONFIGURATION_CHECKPOINT_MAGIC "HVCFGCKP"
+
+/// Checkpoint format version
+#define HV_CONFIGURATION_CHECKPOINT_VERSION 2
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+/**
+ * Checkpoint writer
+ *
+ * Data is appended to an in-memory buffer using the host byte order and
+ * written out by flush(). Blocks are prefixed by their size so that a reader
+ * can skip entries it does not know.
+ */
+class CheckpointWriter {
+public:
+	CheckpointWriter();
+
+	/**
+	 * Write raw bytes
+	 *
+	 * @param data Data
+	 * @param size Data size in bytes
+	 */
+	void writeRaw(const void* data, std::size_t size);
+
+	/**
+	 * Write a trivially copyable value
+	 *
+	 * @param value Value
+	 */
+	template<typename T>
+	void write(const T& value) {
+		writeRaw(&value, sizeof(T));
+	}
+
+	/**
+	 * Write a length-prefixed string
+	 *
+	 * @param str String
+	 */
+	void writeString(const std::string& str);
+
+	/**
+	 * Write a CCI value using a tagged binary encoding
+	 *
+	 * @param value CCI value
+	 */
+	void writeValue(::cci::cci_value::const_reference value);
+
+	/**
+	 * Start a size-prefixed block
+	 *
+	 * @return Block offset, to be given to endBlock()
+	 */
+	std::size_t beginBlock();
+
+	/**
+	 * Terminate a size-prefixed block
+	 *
+	 * @param offset Block offset returned by beginBlock()
+	 */
+	void endBlock(std::size_t offset);
+
+	/**
+	 * Get the number of bytes written so far
+	 *
+	 * @return Number of bytes
+	 */
+	std::size_t size() const;
+
+	/**
+	 * Write the buffer to a stream and clear it
+	 *
+	 * @param stream Output stream
+	 * @return True if successful, otherwise False
+	 */
+	bool flush(std::ostream& stream);
+
+private:
+	/// Pending bytes
+	std::vector<char> buffer;
+};
+
+/**
+ * Checkpoint reader
+ *
+ * Reads a buffer produced by a CheckpointWriter. The reader does not own the
+ * data: it must outlive the reader. Every read fails instead of going past the
+ * end of the buffer.
+ */
+class CheckpointReader {
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param data Checkpoint data
+	 * @param size Data size in bytes
+	 */
+	CheckpointReader(const char* data, std::size_t size);
+
+	/**
+	 * Read raw bytes
+	 *
+	 * @param data Destination
+	 * @param size Number of bytes to read
+	 * @return True if successful, otherwise False
+	 */
+	bool readRaw(void* data, std::size_t size);
+
+	/**
+	 * Read a trivially copyable value
+	 *
+	 * @param value Destination
+	 * @return True if successful, otherwise False
+	 */
+	template<typename T>
+	bool read(T& value) {
+		return readRaw(&value, sizeof(T));
+	}
+
+	/**
+	 * Read a length-prefixed string
+	 *
+	 * @param str Destination
+	 * @return True if successful, otherwise False
+	 */
+	bool readString(std::string& str);
+
+	/**
+	 * Read a CCI value written by CheckpointWriter::writeValue()
+	 *
+	 * @param value Destination
+	 * @return True if successful, otherwise False
+	 */
+	bool readValue(::cci::cci_value& value);
+
+	/**
+	 * Read a size-prefixed block
+	 *
+	 * @param block Reader on the block content
+	 * @return True if successful, otherwise False
+	 */
+	bool readBlock(CheckpointReader& block);
+
+	/**
+	 * Indicates whether all data has been read
+	 *
+	 * @return True if there is nothing left to read, otherwise False
+	 */
+	bool atEnd() const;
+
+	/**
+	 * Get the number of bytes left to read
+	 *
+	 * @return Remaining bytes
+	 */
+	std::size_t remaining() const;
+
+private:
+	/// Checkpoint data
+	const char* data;
+
+	/// Data size in bytes
+	std::size_t size;
+
+	/// Read offset
+	std::size_t offset;
+};
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_CHECKPOINT_H
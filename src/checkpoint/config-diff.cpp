@@ -0,0 +1,60 @@
+/*
+ * @file config-diff.cpp
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Differences between two configuration snapshots
+ */
+
+#include "config-diff.h"
+
+#include <fstream>
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+ConfigDiff::ConfigDiff() : differences() {
+}
+
+const std::vector<ConfigDifference>& ConfigDiff::getDifferences() const {
+	return differences;
+}
+
+std::size_t ConfigDiff::size() const {
+	return differences.size();
+}
+
+bool ConfigDiff::empty() const {
+	return differences.empty();
+}
+
+bool ConfigDiff::exportReport(std::ostream& stream, ExportFormat format) const {
+	ExportOptions options;
+	options.format = format;
+	Exporter exporter(stream, options);
+	for(auto const &difference : differences) {
+		exporter.beginParam(difference.name);
+		::cci::cci_value_map entry;
+		entry.push_entry("before", difference.before);
+		entry.push_entry("after", difference.after);
+		exporter.writeCCIValue(::cci::cci_value(entry));
+		exporter.endParam();
+	}
+	return exporter.finish();
+}
+
+bool ConfigDiff::exportReport(const std::string& filepath, ExportFormat format) const {
+	std::ofstream stream;
+	// The exporter writes large chunks: let them go straight to the file
+	stream.rdbuf()->pubsetbuf(nullptr, 0);
+	stream.open(filepath.c_str(), std::ios::binary | std::ios::trunc);
+	if(!stream) {
+		HV_LOG_ERROR("Unable to open {}", filepath);
+		return false;
+	}
+	bool result = exportReport(stream, format);
+	stream.close();
+	return result && !stream.fail();
+}
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
@@ -0,0 +1,99 @@
+/*
+ * @file config-diff.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Differences between two configuration snapshots
+ */
+
+#ifndef HV_CONFIGURATION_CONFIG_DIFF_H
+#define HV_CONFIGURATION_CONFIG_DIFF_H
+
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <cci_configuration>
+
+#include "../configuration/common.h"
+#include "../exporter/exporter.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+class BrokerBase;
+
+/**
+ * Value of a parameter in two snapshots
+ */
+struct ConfigDifference {
+	/// Parameter name
+	std::string name;
+
+	/// Value in the first snapshot, null if the parameter is not part of it
+	::cci::cci_value before;
+
+	/// Value in the second snapshot, null if the parameter is not part of it
+	::cci::cci_value after;
+};
+
+/**
+ * Configuration diff
+ *
+ * Parameters whose value differs between two snapshots, in name order.
+ * Computed with BrokerBase::diff().
+ */
+class ConfigDiff {
+public:
+	ConfigDiff();
+
+	/**
+	 * Get the differences
+	 *
+	 * @return Differences, in name order
+	 */
+	const std::vector<ConfigDifference>& getDifferences() const;
+
+	/**
+	 * Get the number of differing parameters
+	 *
+	 * @return Number of parameters
+	 */
+	std::size_t size() const;
+
+	/**
+	 * Indicates whether both snapshots hold the same values
+	 *
+	 * @return True if there is no difference, otherwise False
+	 */
+	bool empty() const;
+
+	/**
+	 * Write the differences as a nested YAML or JSON document of
+	 * {before, after} entries
+	 *
+	 * @param stream Output stream
+	 * @param format Output format
+	 * @return True if successful, otherwise False
+	 */
+	bool exportReport(std::ostream& stream, ExportFormat format = EXPORT_YAML) const;
+
+	/**
+	 * Write the differences into a file
+	 *
+	 * @param filepath Output file path, truncated if it exists
+	 * @param format Output format
+	 * @return True if successful, otherwise False
+	 */
+	bool exportReport(const std::string& filepath, ExportFormat format = EXPORT_YAML) const;
+
+private:
+	friend class BrokerBase;
+
+	/// Differences, in name order
+	std::vector<ConfigDifference> differences;
+};
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_CONFIG_DIFF_H
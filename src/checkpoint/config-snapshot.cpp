@@ -0,0 +1,32 @@
+/*
+ * @file config-snapshot.cpp
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief In-memory snapshot of all parameter values of a broker
+ */
+
+#include "config-snapshot.h"
+#include "../param/param-if.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+ConfigSnapshot::ConfigSnapshot() : arena(nullptr), arenaValues(), arenaCount(0), entries(), indexes() {
+}
+
+std::size_t ConfigSnapshot::size() const {
+	return arenaCount + entries.size();
+}
+
+const ParamValueIf* ConfigSnapshot::getValue(const ParamIf* param) const {
+	auto it = indexes.find(param);
+	if(it == indexes.end()) {
+		return nullptr;
+	}
+	// The address may have been reused by another parameter
+	const Entry& entry = entries[it->second];
+	return entry.name == param->getName() ? entry.value.get() : nullptr;
+}
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
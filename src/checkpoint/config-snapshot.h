@@ -0,0 +1,99 @@
+/*
+ * @file config-snapshot.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief In-memory snapshot of all parameter values of a broker
+ */
+
+#ifndef HV_CONFIGURATION_CONFIG_SNAPSHOT_H
+#define HV_CONFIGURATION_CONFIG_SNAPSHOT_H
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "../configuration/common.h"
+#include "../configuration/value-arena.h"
+#include "param-value.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+class BrokerBase;
+
+/**
+ * Configuration snapshot
+ *
+ * Values stored in the broker value arena are kept as a raw copy of the
+ * arena; other values are copied one by one, in name order. A snapshot is
+ * taken with BrokerBase::takeSnapshot() and used as a reset baseline.
+ */
+class ConfigSnapshot {
+public:
+	ConfigSnapshot();
+
+	ConfigSnapshot(ConfigSnapshot&&) HV_CPLUSPLUS_MEMBER_FUNCTION_DEFAULT;
+
+	ConfigSnapshot& operator=(ConfigSnapshot&&) HV_CPLUSPLUS_MEMBER_FUNCTION_DEFAULT;
+
+	/**
+	 * Get the number of parameters
+	 *
+	 * @return Number of parameters
+	 */
+	std::size_t size() const;
+
+	/**
+	 * Get the copied value of a parameter stored outside the value arena
+	 *
+	 * @param param Parameter
+	 * @return Value, null if the parameter is not part of the snapshot
+	 */
+	const ParamValueIf* getValue(const ParamIf* param) const;
+
+	/**
+	 * Get the copied value of a parameter stored in the value arena
+	 *
+	 * @param value Arena value of the parameter
+	 * @return Value, null if the parameter is not part of the snapshot
+	 */
+	template<typename T>
+	const T* getArenaValue(const T* value) const {
+		return arena ? arena->findSnapshotValue(arenaValues, value) : nullptr;
+	}
+
+private:
+	friend class BrokerBase;
+
+	struct Entry {
+		/// Parameter name
+		std::string name;
+
+		/// Parameter, only used as a lookup key
+		const ParamIf* param;
+
+		/// Copied value
+		std::unique_ptr<ParamValueIf> value;
+	};
+
+	/// Arena the arena values were copied from, null if there is none
+	const ValueArena* arena;
+
+	/// Raw copy of the arena values
+	ValueArena::Snapshot arenaValues;
+
+	/// Number of parameters stored in the arena
+	std::size_t arenaCount;
+
+	/// Values stored outside the arena, in name order
+	std::vector<Entry> entries;
+
+	/// Entry index by parameter
+	std::unordered_map<const ParamIf*, std::size_t> indexes;
+};
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_CONFIG_SNAPSHOT_H
@@ -0,0 +1,119 @@
+/*
+ * @file param-serializer.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Parameter value checkpoint serialization
+ */
+
+#ifndef HV_CONFIGURATION_PARAM_SERIALIZER_H
+#define HV_CONFIGURATION_PARAM_SERIALIZER_H
+
+#include "../configuration/common.h"
+#include "checkpoint.h"
+
+#include <array>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+/**
+ * Whether values of a type are stored as raw bytes
+ *
+ * Only arithmetic and enum types qualify: other trivially copyable types may
+ * hold padding bytes or pointers, which must not be checkpointed as is.
+ */
+template<typename T>
+struct ParamSerializerRaw : std::integral_constant<bool,
+		std::is_arithmetic<T>::value || std::is_enum<T>::value> {};
+
+/**
+ * Parameter value serializer
+ *
+ * Generic types go through their CCI value converter and the binary CCI
+ * value encoding. Specialize it to provide a faster encoding for a type.
+ */
+template<typename T, typename Enable = void>
+struct ParamSerializer {
+	static void save(CheckpointWriter& writer, const T& value) {
+		writer.writeValue(::cci::cci_value(value));
+	}
+
+	static bool restore(CheckpointReader& reader, T& value) {
+		::cci::cci_value cciValue;
+		return reader.readValue(cciValue) && cciValue.try_get<T>(value);
+	}
+};
+
+/**
+ * Arithmetic and enum values are stored as raw bytes
+ */
+template<typename T>
+struct ParamSerializer<T, typename std::enable_if<ParamSerializerRaw<T>::value>::type> {
+	static void save(CheckpointWriter& writer, const T& value) {
+		writer.write(value);
+	}
+
+	static bool restore(CheckpointReader& reader, T& value) {
+		return reader.read(value);
+	}
+};
+
+template<>
+struct ParamSerializer<std::string> {
+	static void save(CheckpointWriter& writer, const std::string& value) {
+		writer.writeString(value);
+	}
+
+	static bool restore(CheckpointReader& reader, std::string& value) {
+		return reader.readString(value);
+	}
+};
+
+/**
+ * Vectors of arithmetic and enum values are stored as a size and raw bytes
+ */
+template<typename T, typename A>
+struct ParamSerializer<std::vector<T, A>, typename std::enable_if<ParamSerializerRaw<T>::value &&
+		!std::is_same<T, bool>::value>::type> {
+	static void save(CheckpointWriter& writer, const std::vector<T, A>& value) {
+		writer.write(static_cast<std::uint64_t>(value.size()));
+		writer.writeRaw(value.data(), value.size() * sizeof(T));
+	}
+
+	static bool restore(CheckpointReader& reader, std::vector<T, A>& value) {
+		std::uint64_t size;
+		if(!reader.read(size) || size > reader.remaining() / sizeof(T)) {
+			return false;
+		}
+		// The value is left untouched if the data is invalid
+		std::vector<T, A> restored(value.get_allocator());
+		restored.resize(static_cast<std::size_t>(size));
+		if(!reader.readRaw(restored.data(), restored.size() * sizeof(T))) {
+			return false;
+		}
+		value.swap(restored);
+		return true;
+	}
+};
+
+/**
+ * Arrays of arithmetic and enum values are stored as raw bytes
+ */
+template<typename T, std::size_t N>
+struct ParamSerializer<std::array<T, N>, typename std::enable_if<ParamSerializerRaw<T>::value>::type> {
+	static void save(CheckpointWriter& writer, const std::array<T, N>& value) {
+		writer.writeRaw(value.data(), N * sizeof(T));
+	}
+
+	static bool restore(CheckpointReader& reader, std::array<T, N>& value) {
+		return reader.readRaw(value.data(), N * sizeof(T));
+	}
+};
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_PARAM_SERIALIZER_H
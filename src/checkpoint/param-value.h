@@ -0,0 +1,63 @@
+/*
+ * @file param-value.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Type-erased copy of a parameter value
+ */
+
+#ifndef HV_CONFIGURATION_PARAM_VALUE_H
+#define HV_CONFIGURATION_PARAM_VALUE_H
+
+#include <cci_configuration>
+
+#include "../configuration/common.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+/**
+ * Copy of a parameter value, of the parameter type
+ */
+class ParamValueIf {
+public:
+	virtual ~ParamValueIf() HV_CPLUSPLUS_MEMBER_FUNCTION_DEFAULT;
+
+	/**
+	 * Compare with another value
+	 *
+	 * @param other Value
+	 * @return True if both values have the same type and are equal, otherwise False
+	 */
+	virtual bool equals(const ParamValueIf& other) const = 0;
+
+	/**
+	 * Convert to a CCI value
+	 *
+	 * @return CCI value
+	 */
+	virtual ::cci::cci_value toCCIValue() const = 0;
+};
+
+template<typename T>
+class ParamValue : public ParamValueIf {
+public:
+	explicit ParamValue(const T& value) : value(value) {
+	}
+
+	bool equals(const ParamValueIf& other) const override {
+		const ParamValue<T>* otherValue = dynamic_cast<const ParamValue<T>*>(&other);
+		return otherValue && otherValue->value == value;
+	}
+
+	::cci::cci_value toCCIValue() const override {
+		return ::cci::cci_value(value);
+	}
+
+	/// Value
+	const T value;
+};
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_PARAM_VALUE_H
@@ -8,12 +8,18 @@
  */
 
 #include "common-cci.h"
+#include "../broker/broker.h"
 
 HV_CONFIGURATION_OPEN_NAMESPACE
 
 ::cci::cci_broker_handle findBrokerConvenience(const ::cci::cci_originator& originator)
 {
 	if (!sc_core::sc_get_current_object()) {
+		// Top-level parameters of a thread with its own broker
+		Broker* broker = _getThreadBroker();
+		if (broker) {
+			return ::cci::cci_broker_handle(broker->getCCIBroker(), originator);
+		}
 		return ::cci::cci_get_global_broker(originator);
 	} else {
 		return ::cci::cci_get_broker();
@@ -11,6 +11,7 @@
 #define HV_CONFIGURATION_COMMON_CCI_H
 
 #include "common.h"
+#include "originator-table.h"
 
 // TODO: remove me
 // #define HV_CCI_CALLBACK_TYPES
@@ -18,6 +19,8 @@
 // #include "cci_core/cci_meta.h"
 // #include "../broker/cci/broker-cci-callbacks.h"
 
+#include <memory>
+
 #include <cci_configuration>
 
 HV_CONFIGURATION_OPEN_NAMESPACE
@@ -26,11 +29,69 @@ template<class T>
 class CCICallbackObject {
 public:
 	CCICallbackObject(T callback, const ::cci::cci_originator& originator):
-			callback(callback), originator(originator) {
+			callback(callback), originatorId(internOriginator(originator)) {
 
 	}
 	T callback;
-	::cci::cci_originator originator;
+	OriginatorId originatorId;
+};
+
+/**
+ * Preset change listener
+ *
+ * Implemented by parameters caching their preset value. The broker notifies
+ * the parameter registered with the preset name when the preset is set.
+ */
+class PresetListenerIf {
+public:
+	/**
+	 * Called when the preset value of the parameter has been set
+	 *
+	 * @param value New preset value
+	 */
+	virtual void presetChanged(const ::cci::cci_value& value) = 0;
+
+	virtual ~PresetListenerIf() HV_CPLUSPLUS_MEMBER_FUNCTION_DEFAULT;
+};
+
+/**
+ * CCI callback event context
+ *
+ * The originator and the parameter handle carried by CCI callback events are
+ * only built when a CCI callback is actually dispatched.
+ */
+class CCIEventContext {
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param param CCI parameter
+	 * @param originator Reader or writer, null for the parameter originator
+	 */
+	CCIEventContext(::cci::cci_param_if* param, const ::cci::cci_originator* originator) :
+			param(param), originator(originator), paramOriginator(), handle() {
+	}
+
+	const ::cci::cci_originator& getOriginator() {
+		if(!originator) {
+			paramOriginator.reset(new ::cci::cci_originator(param->get_originator()));
+			originator = paramOriginator.get();
+		}
+		return *originator;
+	}
+
+	const ::cci::cci_param_untyped_handle& getHandle() {
+		if(!handle) {
+			handle.reset(new ::cci::cci_param_untyped_handle(*param, getOriginator()));
+		}
+		return *handle;
+	}
+
+private:
+	::cci::cci_param_if* param;
+	const ::cci::cci_originator* originator;
+	std::unique_ptr<::cci::cci_originator> paramOriginator;
+	std::unique_ptr<::cci::cci_param_untyped_handle> handle;
 };
 
 ::cci::cci_broker_handle findBrokerConvenience(const ::cci::cci_originator& originator);
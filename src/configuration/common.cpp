@@ -9,36 +9,95 @@
 
 #include "common.h"
 #include "../broker/broker.h"
+#include "../profiler/profiler.h"
 
+#include <atomic>
+#include <mutex>
 #include <systemc>
+#include <unordered_map>
 
 HV_CONFIGURATION_OPEN_NAMESPACE
 
 // Private
-Broker* _globalBroker;
+/// Broker of the threads without a bound broker (the first broker created)
+static std::atomic<Broker*> _globalBroker(nullptr);
+
+/// Broker explicitly bound to the current thread (BrokerContext)
+static thread_local Broker* _threadBroker = nullptr;
+
+/// Serializes the accesses to the SystemC name registry
+static std::mutex _nameMutex;
 
 Broker* getBroker() {
-	return _globalBroker;
+	return _threadBroker ? _threadBroker : _globalBroker.load();
 }
 
-std::string generateRelativeUniqueName(const std::string& name) {
-	if(name.empty()) {
-		HV_LOG_CRITICAL("Empty parameter name is not allowed");
-		HV_EXIT_FAILURE();
-	}
+namespace {
+
+/// Hierarchy prefix of the parameters created under an object
+struct HierarchyPrefix {
+	/// Name of the object, to detect a reused address
+	std::string objectName;
+
+	/// Name of the parent module followed by the hierarchy separator
+	std::string prefix;
+};
+
+/**
+ * Get the hierarchy prefix of the parameters created by the current object
+ *
+ * The parent walk and the prefix are computed once per object.
+ */
+const std::string& getHierarchyPrefix() {
+	static thread_local std::unordered_map<const sc_core::sc_object*, HierarchyPrefix> prefixes;
+	static const std::string emptyPrefix;
 
-	// Hierarchical name
-	std::string hierarchicalName = name;
 	sc_core::sc_object* currentObj = sc_core::sc_get_current_object();
-	for (sc_core::sc_process_handle current_proc(currentObj);
+	if(!currentObj) {
+		return emptyPrefix;
+	}
+
+	auto it = prefixes.find(currentObj);
+	if(it != prefixes.end() && it->second.objectName == currentObj->name()) {
+		return it->second.prefix;
+	}
+
+	HierarchyPrefix& entry = prefixes[currentObj];
+	entry.objectName = currentObj->name();
+	entry.prefix.clear();
+
+	sc_core::sc_object* parentObj = currentObj;
+	for (sc_core::sc_process_handle current_proc(parentObj);
 		 current_proc.valid();
-		 current_proc = sc_core::sc_process_handle(currentObj)) {
-		currentObj = current_proc.get_parent_object();
+		 current_proc = sc_core::sc_process_handle(parentObj)) {
+		parentObj = current_proc.get_parent_object();
+	}
+	if(parentObj) {
+		entry.prefix = parentObj->name();
+		entry.prefix += sc_core::SC_HIERARCHY_CHAR;
 	}
-	if(currentObj) {
-		hierarchicalName = std::string(currentObj->name()) + sc_core::SC_HIERARCHY_CHAR + name;
+	return entry.prefix;
+}
+
+std::string generateHierarchicalName(const std::string& name) {
+	if(name.empty()) {
+		HV_LOG_CRITICAL("Empty parameter name is not allowed");
+		HV_EXIT_FAILURE();
 	}
 
+	const std::string& prefix = getHierarchyPrefix();
+	std::string hierarchicalName;
+	hierarchicalName.reserve(prefix.size() + name.size());
+	hierarchicalName.append(prefix).append(name);
+	return hierarchicalName;
+}
+
+}
+
+std::string generateRelativeUniqueName(const std::string& name) {
+	std::string hierarchicalName = generateHierarchicalName(name);
+
+	std::lock_guard<std::mutex> lock(_nameMutex);
 	// Unique name
 	// SystemC >= 2.3.2 required
 	if(sc_core::sc_hierarchical_name_exists(hierarchicalName.c_str())) {
@@ -51,28 +110,78 @@ std::string generateRelativeUniqueName(const std::string& name) {
 }
 
 bool registerName(const std::string& name) {
+	std::lock_guard<std::mutex> lock(_nameMutex);
 	return sc_core::sc_register_hierarchical_name(name.c_str());
 }
 
+bool unregisterName(const std::string& name) {
+	std::lock_guard<std::mutex> lock(_nameMutex);
+	return sc_core::sc_unregister_hierarchical_name(name.c_str());
+}
+
+std::string generateAndRegisterUniqueName(const std::string& name) {
+	HV_CFG_PROFILE_SCOPE(PROFILE_NAME_GENERATION);
+	std::string hierarchicalName = generateHierarchicalName(name);
+	HV_CFG_PROFILE_BYTES(hierarchicalName.capacity());
+
+	std::lock_guard<std::mutex> lock(_nameMutex);
+	// Registration fails if the name already exists: one name lookup when free
+	if(!sc_core::sc_register_hierarchical_name(hierarchicalName.c_str())) {
+		const char* newName = sc_core::sc_gen_unique_name(hierarchicalName.c_str());
+		HV_LOG_WARNING("{} is already used in the SystemC hierarchy, using {} instead", hierarchicalName, newName);
+		hierarchicalName = newName;
+		sc_core::sc_register_hierarchical_name(newName);
+	}
+	return hierarchicalName;
+}
+
 void _registerGlobalBroker(Broker* broker) {
-	_globalBroker = broker;
+	Broker* expected = nullptr;
+	_globalBroker.compare_exchange_strong(expected, broker);
+}
+
+void _unregisterGlobalBroker(Broker* broker) {
+	if(_threadBroker == broker) {
+		_threadBroker = nullptr;
+	}
+	Broker* expected = broker;
+	_globalBroker.compare_exchange_strong(expected, nullptr);
+}
+
+Broker* _getThreadBroker() {
+	return _threadBroker;
 }
 
-void _unregisterGlobalBroker() {
-	_globalBroker = nullptr;
+void _setThreadBroker(Broker* broker) {
+	_threadBroker = broker;
 }
 
-void _registerParam(ParamIf* param) {
-	if(_globalBroker) {
-		_globalBroker->addParam(param);
+Broker* _registerParam(ParamIf* param) {
+	Broker* broker = getBroker();
+	if(broker) {
+		broker->addParam(param);
 	} else {
 		HV_LOG_ERROR("Unable to register the param {}. No broker available.", param->getName());
 	}
+	return broker;
+}
+
+void _unregisterParam(Broker* broker, ParamIf* param) {
+	broker->removeParam(param);
+}
+
+void _markParamDirty(Broker* broker, ParamIf* param) {
+	broker->markParamDirty(param);
+}
+
+ValueArena* _getValueArena(Broker* broker) {
+	return broker->getValueArena();
 }
 
 void _hasPresetValue(const std::string& name) {
-	if(_globalBroker) {
-		_globalBroker->hasPresetValue(name);
+	Broker* broker = getBroker();
+	if(broker) {
+		broker->hasPresetValue(name);
 	} else {
 		HV_LOG_ERROR("Unable to check preset value of param {}. No broker available.", name);
 	}
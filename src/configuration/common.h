@@ -26,15 +26,41 @@ HV_CONFIGURATION_OPEN_NAMESPACE
 
 class Broker;
 class ParamIf;
+class ValueArena;
 
+/**
+ * Get the broker of the current thread
+ *
+ * A broker belongs to the threads it is bound to with a BrokerContext.
+ * Threads without a bound broker use the first broker created in the process.
+ *
+ * @return Broker, null if there is none
+ */
 Broker* getBroker();
 std::string generateRelativeUniqueName(const std::string& name);
 bool registerName(const std::string& name);
+bool unregisterName(const std::string& name);
+
+/**
+ * Generate the hierarchical unique name of a parameter and register it
+ *
+ * Same as generateRelativeUniqueName() followed by registerName(), with a
+ * single name lookup when the name is free.
+ *
+ * @param name Parameter name, relative to the current module
+ * @return Registered hierarchical name
+ */
+std::string generateAndRegisterUniqueName(const std::string& name);
 
 // Private
 void _registerGlobalBroker(Broker* broker);
-void _unregisterGlobalBroker();
-void _registerParam(ParamIf* param);
+void _unregisterGlobalBroker(Broker* broker);
+Broker* _getThreadBroker();
+void _setThreadBroker(Broker* broker);
+Broker* _registerParam(ParamIf* param);
+void _unregisterParam(Broker* broker, ParamIf* param);
+void _markParamDirty(Broker* broker, ParamIf* param);
+ValueArena* _getValueArena(Broker* broker);
 void _hasPresetValue(const std::string& name);
 
 template <typename T>
@@ -13,8 +13,16 @@
 #include "common.h"
 #include "common-cci.h"
 #include "../broker/broker.h"
+#include "../checkpoint/checkpoint.h"
+#include "../checkpoint/config-diff.h"
+#include "../checkpoint/config-snapshot.h"
+#include "../exporter/exporter.h"
 #include "../loader/loader.h"
+#include "../loader/reloader.h"
 #include "../param/param.h"
+#include "../param/param-array.h"
+#include "../param/param-struct.h"
+#include "../profiler/profiler.h"
 #include "../storage/storage.h"
 
 #endif // HV_CONFIGURATION_CONFIGURATION_H
@@ -0,0 +1,48 @@
+/*
+ * @file description-pool.cpp
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Interned parameter descriptions
+ */
+
+#include "description-pool.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+DescriptionPool::DescriptionPool() : descriptions(), mutex() {
+}
+
+DescriptionPtr DescriptionPool::intern(const std::string& description) {
+	if(description.empty()) {
+		return nullptr;
+	}
+	std::lock_guard<std::mutex> lock(mutex);
+	return &*descriptions.insert(description).first;
+}
+
+std::size_t DescriptionPool::size() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return descriptions.size();
+}
+
+static DescriptionPool& getDescriptionPool() {
+	static DescriptionPool descriptionPool;
+	return descriptionPool;
+}
+
+DescriptionPtr internDescription(const std::string& description) {
+	return getDescriptionPool().intern(description);
+}
+
+std::size_t getDescriptionCount() {
+	return getDescriptionPool().size();
+}
+
+const std::string& getInternedDescription(DescriptionPtr description) {
+	static const std::string emptyDescription;
+	return description ? *description : emptyDescription;
+}
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
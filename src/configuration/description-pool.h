@@ -0,0 +1,84 @@
+/*
+ * @file description-pool.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Interned parameter descriptions
+ */
+
+#ifndef HV_CONFIGURATION_DESCRIPTION_POOL_H
+#define HV_CONFIGURATION_DESCRIPTION_POOL_H
+
+#include "common.h"
+
+#include <mutex>
+#include <string>
+#include <unordered_set>
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+/// Interned description, null when a parameter has no description
+typedef const std::string* DescriptionPtr;
+
+/**
+ * Description pool
+ *
+ * Descriptions are deduplicated by content, so replicated IP blocks share a
+ * single string per distinct description and parameters only hold a
+ * pointer. Entries are never released: a simulation only uses a bounded set
+ * of distinct descriptions.
+ */
+class DescriptionPool {
+public:
+	DescriptionPool();
+
+	/**
+	 * Intern a description
+	 *
+	 * @param description Description
+	 * @return Interned description, null for an empty description
+	 */
+	DescriptionPtr intern(const std::string& description);
+
+	/**
+	 * Get the number of interned descriptions
+	 *
+	 * @return Number of descriptions
+	 */
+	std::size_t size() const;
+
+private:
+	/// Interned descriptions (stable references)
+	std::unordered_set<std::string> descriptions;
+
+	/// Protects the pool
+	mutable std::mutex mutex;
+};
+
+/**
+ * Intern a description into the global description pool
+ *
+ * @param description Description
+ * @return Interned description, null for an empty description
+ */
+DescriptionPtr internDescription(const std::string& description);
+
+/**
+ * Get the number of descriptions in the global description pool
+ *
+ * @return Number of descriptions
+ */
+std::size_t getDescriptionCount();
+
+/**
+ * Get an interned description
+ *
+ * @param description Interned description, may be null
+ * @return Description, empty if null
+ */
+const std::string& getInternedDescription(DescriptionPtr description);
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_DESCRIPTION_POOL_H
@@ -0,0 +1,84 @@
+/*
+ * @file metadata-table.cpp
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Shared parameter metadata
+ */
+
+#include "metadata-table.h"
+
+#include <algorithm>
+
+/// Initial number of entries triggering a purge of released metadata
+#define HV_CONFIGURATION_METADATA_PURGE_THRESHOLD 64
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+MetadataTable::MetadataTable() : entries(), purgeThreshold(HV_CONFIGURATION_METADATA_PURGE_THRESHOLD),
+		mutex() {
+}
+
+MetadataPtr MetadataTable::intern(const ::cci::cci_value_map& metadata) {
+	const std::string key(metadata.to_json());
+
+	std::lock_guard<std::mutex> lock(mutex);
+	auto it = entries.find(key);
+	if(it != entries.end()) {
+		MetadataPtr shared = it->second.lock();
+		if(shared) {
+			return shared;
+		}
+	}
+
+	MetadataPtr shared = std::make_shared<const ::cci::cci_value_map>(metadata);
+	entries[key] = shared;
+	if(entries.size() >= purgeThreshold) {
+		purge();
+	}
+	return shared;
+}
+
+std::size_t MetadataTable::size() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	std::size_t count = 0;
+	for(auto const &entry : entries) {
+		if(!entry.second.expired()) {
+			count++;
+		}
+	}
+	return count;
+}
+
+void MetadataTable::purge() {
+	for(auto it = entries.begin(); it != entries.end();) {
+		if(it->second.expired()) {
+			it = entries.erase(it);
+		} else {
+			++it;
+		}
+	}
+	// Keep purges amortized whatever the number of live entries
+	purgeThreshold = std::max<std::size_t>(HV_CONFIGURATION_METADATA_PURGE_THRESHOLD, 2 * entries.size());
+}
+
+static MetadataTable& getMetadataTable() {
+	static MetadataTable metadataTable;
+	return metadataTable;
+}
+
+MetadataPtr internMetadata(const ::cci::cci_value_map& metadata) {
+	return getMetadataTable().intern(metadata);
+}
+
+std::size_t getMetadataCount() {
+	return getMetadataTable().size();
+}
+
+const ::cci::cci_value_map& getEmptyMetadata() {
+	static const ::cci::cci_value_map emptyMetadata;
+	return emptyMetadata;
+}
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
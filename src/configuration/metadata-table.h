@@ -0,0 +1,91 @@
+/*
+ * @file metadata-table.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Shared parameter metadata
+ */
+
+#ifndef HV_CONFIGURATION_METADATA_TABLE_H
+#define HV_CONFIGURATION_METADATA_TABLE_H
+
+#include "common.h"
+
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <cci_configuration>
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+/// Shared immutable metadata, null when a parameter has no metadata
+typedef std::shared_ptr<const ::cci::cci_value_map> MetadataPtr;
+
+/**
+ * Metadata table
+ *
+ * Metadata maps are immutable and deduplicated by content, so parameters
+ * carrying identical metadata (e.g. instances of the same IP block) share a
+ * single map. Entries are released with their last user.
+ */
+class MetadataTable {
+public:
+	MetadataTable();
+
+	/**
+	 * Intern a metadata map
+	 *
+	 * @param metadata Metadata map
+	 * @return Shared metadata equal to the given map
+	 */
+	MetadataPtr intern(const ::cci::cci_value_map& metadata);
+
+	/**
+	 * Get the number of live metadata maps
+	 *
+	 * @return Number of metadata maps
+	 */
+	std::size_t size() const;
+
+private:
+	/// Remove entries no longer used by any parameter
+	void purge();
+
+	/// Interned metadata, keyed by their JSON serialization
+	std::unordered_map<std::string, std::weak_ptr<const ::cci::cci_value_map> > entries;
+
+	/// Number of entries triggering the next purge
+	std::size_t purgeThreshold;
+
+	/// Protects the table
+	mutable std::mutex mutex;
+};
+
+/**
+ * Intern a metadata map into the global metadata table
+ *
+ * @param metadata Metadata map
+ * @return Shared metadata
+ */
+MetadataPtr internMetadata(const ::cci::cci_value_map& metadata);
+
+/**
+ * Get the number of live metadata maps in the global metadata table
+ *
+ * @return Number of metadata maps
+ */
+std::size_t getMetadataCount();
+
+/**
+ * Get an empty metadata map
+ *
+ * @return Empty metadata map
+ */
+const ::cci::cci_value_map& getEmptyMetadata();
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_METADATA_TABLE_H
@@ -0,0 +1,96 @@
+/*
+ * @file originator-table.cpp
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Interned CCI originators
+ */
+
+#include "originator-table.h"
+
+/// Name of the originator returned for an unknown ID
+#define HV_CONFIGURATION_UNKNOWN_ORIGINATOR_NAME "__hv_cfg_unknown_originator__"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+OriginatorTable::OriginatorTable() : originators(), nameIds(), mutex() {
+}
+
+OriginatorId OriginatorTable::intern(const ::cci::cci_originator& originator) {
+	std::lock_guard<std::mutex> lock(mutex);
+	OriginatorId id;
+	if(findLocked(originator, id)) {
+		// A new object with the name of a destroyed one replaces it
+		const sc_core::sc_object* object = originator.get_object();
+		if(object && object != originators[id].get_object()) {
+			originators[id] = originator;
+		}
+		return id;
+	}
+	id = static_cast<OriginatorId>(originators.size());
+	originators.push_back(originator);
+	nameIds.insert(std::make_pair(std::string(originator.name()), id));
+	return id;
+}
+
+bool OriginatorTable::find(const ::cci::cci_originator& originator, OriginatorId& id) const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return findLocked(originator, id);
+}
+
+bool OriginatorTable::findLocked(const ::cci::cci_originator& originator, OriginatorId& id) const {
+	auto it = nameIds.find(std::string(originator.name()));
+	if(it == nameIds.end()) {
+		return false;
+	}
+	id = it->second;
+	return true;
+}
+
+::cci::cci_originator OriginatorTable::get(OriginatorId id) const {
+	std::lock_guard<std::mutex> lock(mutex);
+	if(id < originators.size()) {
+		return originators[id];
+	}
+	HV_LOG_ERROR("Unknown originator ID {}", id);
+	return ::cci::cci_originator(std::string(HV_CONFIGURATION_UNKNOWN_ORIGINATOR_NAME));
+}
+
+std::size_t OriginatorTable::size() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return originators.size();
+}
+
+static OriginatorTable& getOriginatorTable() {
+	static OriginatorTable originatorTable;
+	return originatorTable;
+}
+
+OriginatorId internOriginator(const ::cci::cci_originator& originator) {
+	// Writers usually repeat: the latest originator of each thread skips the table lock
+	static thread_local const sc_core::sc_object* lastObject = nullptr;
+	static thread_local std::string lastName;
+	static thread_local OriginatorId lastId = 0;
+	static thread_local bool lastValid = false;
+	const sc_core::sc_object* object = originator.get_object();
+	const char* name = originator.name();
+	if(lastValid && object == lastObject && lastName == name) {
+		return lastId;
+	}
+	lastId = getOriginatorTable().intern(originator);
+	lastObject = object;
+	lastName = name;
+	lastValid = true;
+	return lastId;
+}
+
+bool findOriginator(const ::cci::cci_originator& originator, OriginatorId& id) {
+	return getOriginatorTable().find(originator, id);
+}
+
+::cci::cci_originator getOriginator(OriginatorId id) {
+	return getOriginatorTable().get(id);
+}
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
@@ -0,0 +1,121 @@
+/*
+ * @file originator-table.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Interned CCI originators
+ */
+
+#ifndef HV_CONFIGURATION_ORIGINATOR_TABLE_H
+#define HV_CONFIGURATION_ORIGINATOR_TABLE_H
+
+#include "common.h"
+
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <cci_configuration>
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+/// Compact originator reference
+typedef std::uint32_t OriginatorId;
+
+/**
+ * Originator table
+ *
+ * Originators are interned once and referenced by a compact ID. Two
+ * originators sharing the same ID are equal, so originator checks become
+ * integer compares. Originators are identified by their hierarchical name:
+ * an object created with the name of a destroyed one gets its ID, and
+ * replaces it in the table. Entries are never released: a simulation only
+ * uses a handful of distinct originators.
+ */
+class OriginatorTable {
+public:
+	OriginatorTable();
+
+	/**
+	 * Intern an originator
+	 *
+	 * @param originator Originator
+	 * @return Originator ID
+	 */
+	OriginatorId intern(const ::cci::cci_originator& originator);
+
+	/**
+	 * Find an interned originator, without interning it
+	 *
+	 * @param originator Originator
+	 * @param id Originator ID, set if found
+	 * @return True if the originator is interned
+	 */
+	bool find(const ::cci::cci_originator& originator, OriginatorId& id) const;
+
+	/**
+	 * Get an interned originator
+	 *
+	 * @param id Originator ID
+	 * @return Originator
+	 */
+	::cci::cci_originator get(OriginatorId id) const;
+
+	/**
+	 * Get the number of interned originators
+	 *
+	 * @return Number of originators
+	 */
+	std::size_t size() const;
+
+private:
+	/**
+	 * Find an interned originator, the table being locked
+	 *
+	 * @param originator Originator
+	 * @param id Originator ID, set if found
+	 * @return True if the originator is interned
+	 */
+	bool findLocked(const ::cci::cci_originator& originator, OriginatorId& id) const;
+
+	/// Interned originators, indexed by ID (stable references)
+	std::deque<::cci::cci_originator> originators;
+
+	/// Originator IDs by name
+	std::unordered_map<std::string, OriginatorId> nameIds;
+
+	/// Protects the table
+	mutable std::mutex mutex;
+};
+
+/**
+ * Intern an originator into the global originator table
+ *
+ * @param originator Originator
+ * @return Originator ID
+ */
+OriginatorId internOriginator(const ::cci::cci_originator& originator);
+
+/**
+ * Find an originator in the global originator table, without interning it
+ *
+ * @param originator Originator
+ * @param id Originator ID, set if found
+ * @return True if the originator is interned
+ */
+bool findOriginator(const ::cci::cci_originator& originator, OriginatorId& id);
+
+/**
+ * Get an originator from the global originator table
+ *
+ * @param id Originator ID
+ * @return Originator
+ */
+::cci::cci_originator getOriginator(OriginatorId id);
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_ORIGINATOR_TABLE_H
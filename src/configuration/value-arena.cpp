@@ -0,0 +1,82 @@
+/*
+ * @file value-arena.cpp
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Contiguous storage of scalar parameter values
+ */
+
+#include "value-arena.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+ValuePoolIf::~ValuePoolIf() {
+}
+
+ValueArena::Snapshot::Snapshot() : generation(0), pools() {
+}
+
+std::size_t ValueArena::Snapshot::size() const {
+	std::size_t result = 0;
+	for(auto const &pool : pools) {
+		result += pool.size();
+	}
+	return result;
+}
+
+ValueArena::ValueArena() : pools(), poolIndexes(), generation(0) {
+}
+
+ValueArena::~ValueArena() {
+}
+
+std::size_t ValueArena::size() const {
+	std::size_t result = 0;
+	for(auto const &pool : pools) {
+		result += pool->size();
+	}
+	return result;
+}
+
+ValueArena::Snapshot ValueArena::takeSnapshot() const {
+	Snapshot snapshot;
+	snapshot.generation = generation;
+	snapshot.pools.resize(pools.size());
+	for(std::size_t i = 0; i < pools.size(); ++i) {
+		pools[i]->save(snapshot.pools[i]);
+	}
+	return snapshot;
+}
+
+bool ValueArena::restoreSnapshot(const Snapshot& snapshot, std::vector<ParamIf*>& changed, bool apply) {
+	if(snapshot.generation != generation || snapshot.pools.size() != pools.size()) {
+		HV_LOG_ERROR("Unable to restore a value snapshot taken before parameters were added or removed");
+		return false;
+	}
+	for(std::size_t i = 0; i < pools.size(); ++i) {
+		pools[i]->restore(snapshot.pools[i], changed, apply);
+	}
+	return true;
+}
+
+bool ValueArena::compareSnapshots(const Snapshot& first, const Snapshot& second,
+		std::vector<ParamIf*>& changed) const {
+	if(first.generation != generation || second.generation != generation
+			|| first.pools.size() != pools.size() || second.pools.size() != pools.size()) {
+		HV_LOG_ERROR("Unable to compare value snapshots taken before parameters were added or removed");
+		return false;
+	}
+	for(std::size_t i = 0; i < pools.size(); ++i) {
+		pools[i]->compare(first.pools[i], second.pools[i], changed);
+	}
+	return true;
+}
+
+void ValueArena::resetToDefaults(std::vector<ParamIf*>& changed, bool apply) {
+	for(auto const &pool : pools) {
+		pool->resetToDefaults(changed, apply);
+	}
+}
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
@@ -0,0 +1,337 @@
+/*
+ * @file value-arena.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Contiguous storage of scalar parameter values
+ */
+
+#ifndef HV_CONFIGURATION_VALUE_ARENA_H
+#define HV_CONFIGURATION_VALUE_ARENA_H
+
+#include "common.h"
+
+#include <cstdint>
+#include <map>
+#include <memory>
+#include <type_traits>
+#include <typeindex>
+#include <unordered_map>
+#include <vector>
+
+/// Number of values per arena chunk
+#define HV_CONFIGURATION_VALUE_ARENA_CHUNK_SIZE 4096
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+class ParamIf;
+
+/**
+ * Value pool interface, one pool per scalar type
+ */
+class ValuePoolIf {
+public:
+	virtual ~ValuePoolIf();
+
+	/**
+	 * Get the number of live values
+	 *
+	 * @return Number of values
+	 */
+	virtual std::size_t size() const = 0;
+
+	/**
+	 * Copy all values
+	 *
+	 * @param data Raw copy of the values
+	 */
+	virtual void save(std::vector<char>& data) const = 0;
+
+	/**
+	 * Restore values from a copy taken by save
+	 *
+	 * @param data Raw copy of the values
+	 * @param changed Owners of the values differing from the copy
+	 * @param apply Whether values are written or only compared
+	 */
+	virtual void restore(const std::vector<char>& data, std::vector<ParamIf*>& changed, bool apply) = 0;
+
+	/**
+	 * Restore all values to their defaults
+	 *
+	 * @param changed Owners of the values differing from their defaults
+	 * @param apply Whether values are written or only compared
+	 */
+	virtual void resetToDefaults(std::vector<ParamIf*>& changed, bool apply) = 0;
+
+	/**
+	 * Compare two copies taken by save
+	 *
+	 * @param first First copy
+	 * @param second Second copy
+	 * @param changed Owners of the values differing between the copies
+	 */
+	virtual void compare(const std::vector<char>& first, const std::vector<char>& second,
+			std::vector<ParamIf*>& changed) const = 0;
+};
+
+/**
+ * Values of one scalar type
+ *
+ * Values, default values and owners are stored in separate arrays of fixed
+ * size chunks: addresses are stable and broker-wide operations are linear
+ * scans over contiguous values. Released slots are reset to T() and reused.
+ */
+template<typename T>
+class ValuePool : public ValuePoolIf {
+public:
+	ValuePool();
+
+	T* allocate(ParamIf* owner, const T& value, const T& defaultValue);
+
+	bool release(T* value);
+
+	/**
+	 * Get the slot of a value
+	 *
+	 * @param value Value address returned by allocate
+	 * @param slot Slot index
+	 * @return True if the value belongs to the pool, otherwise False
+	 */
+	bool findSlot(const T* value, std::size_t& slot) const;
+
+	std::size_t size() const override;
+
+	void save(std::vector<char>& data) const override;
+
+	void restore(const std::vector<char>& data, std::vector<ParamIf*>& changed, bool apply) override;
+
+	void resetToDefaults(std::vector<ParamIf*>& changed, bool apply) override;
+
+	void compare(const std::vector<char>& first, const std::vector<char>& second,
+			std::vector<ParamIf*>& changed) const override;
+
+private:
+	struct Chunk {
+		T values[HV_CONFIGURATION_VALUE_ARENA_CHUNK_SIZE];
+		T defaults[HV_CONFIGURATION_VALUE_ARENA_CHUNK_SIZE];
+		ParamIf* owners[HV_CONFIGURATION_VALUE_ARENA_CHUNK_SIZE];
+	};
+
+	/// Number of slots used in a chunk
+	std::size_t getChunkUsed(std::size_t index) const;
+
+	/// Chunks, in slot order
+	std::vector<std::unique_ptr<Chunk> > chunks;
+
+	/// Chunk index by value array address
+	std::map<const T*, std::size_t> chunkIndexes;
+
+	/// Released slots
+	std::vector<std::size_t> freeSlots;
+
+	/// Number of slots ever handed out
+	std::size_t used;
+};
+
+/**
+ * Value arena
+ *
+ * Optional broker-owned storage of bool, integral and floating point
+ * parameter values, grouped by type. Snapshots and resets are block copies
+ * that bypass callbacks and locks, like checkpoint restores; they report
+ * the parameters whose value changed. The arena is not thread-safe: as its
+ * broker, it is used by a single thread.
+ */
+class ValueArena {
+public:
+	/**
+	 * Raw copy of all arena values
+	 */
+	class Snapshot {
+	public:
+		Snapshot();
+
+		/**
+		 * Get the snapshot size
+		 *
+		 * @return Size in bytes
+		 */
+		std::size_t size() const;
+
+	private:
+		friend class ValueArena;
+
+		/// Arena layout generation the snapshot was taken at
+		std::uint64_t generation;
+
+		/// Values of each pool
+		std::vector<std::vector<char> > pools;
+	};
+
+	ValueArena();
+
+	ValueArena(const ValueArena&) HV_CPLUSPLUS_MEMBER_FUNCTION_DELETE;
+
+	ValueArena& operator=(const ValueArena&) HV_CPLUSPLUS_MEMBER_FUNCTION_DELETE;
+
+	~ValueArena();
+
+	/**
+	 * Allocate a value
+	 *
+	 * @param owner Parameter owning the value
+	 * @param value Initial value
+	 * @param defaultValue Default value
+	 * @return Stable value address
+	 */
+	template<typename T>
+	T* allocate(ParamIf* owner, const T& value, const T& defaultValue);
+
+	/**
+	 * Release a value
+	 *
+	 * @param value Value address returned by allocate
+	 */
+	template<typename T>
+	void release(T* value);
+
+	/**
+	 * Get the number of live values
+	 *
+	 * @return Number of values
+	 */
+	std::size_t size() const;
+
+	/**
+	 * Copy all values
+	 *
+	 * @return Snapshot
+	 */
+	Snapshot takeSnapshot() const;
+
+	/**
+	 * Restore all values from a snapshot
+	 *
+	 * A snapshot can only be restored while the set of values is unchanged.
+	 *
+	 * @param snapshot Snapshot
+	 * @param changed Owners of the values differing from the snapshot
+	 * @param apply Whether values are written or only compared
+	 * @return True on success, otherwise False
+	 */
+	bool restoreSnapshot(const Snapshot& snapshot, std::vector<ParamIf*>& changed, bool apply = true);
+
+	/**
+	 * Restore all values to their defaults
+	 *
+	 * @param changed Owners of the values differing from their defaults
+	 * @param apply Whether values are written or only compared
+	 */
+	void resetToDefaults(std::vector<ParamIf*>& changed, bool apply = true);
+
+	/**
+	 * Compare two snapshots
+	 *
+	 * Both snapshots must have been taken while the current set of values
+	 * existed.
+	 *
+	 * @param first First snapshot
+	 * @param second Second snapshot
+	 * @param changed Owners of the values differing between the snapshots
+	 * @return True on success, otherwise False
+	 */
+	bool compareSnapshots(const Snapshot& first, const Snapshot& second, std::vector<ParamIf*>& changed) const;
+
+	/**
+	 * Get the value of a slot in a snapshot
+	 *
+	 * @param snapshot Snapshot
+	 * @param value Value address returned by allocate
+	 * @return Value in the snapshot, null if the snapshot does not hold it
+	 */
+	template<typename T>
+	const T* findSnapshotValue(const Snapshot& snapshot, const T* value) const;
+
+private:
+	template<typename T>
+	ValuePool<T>& getPool();
+
+	/// Find the pool of a type, returning its index or pools.size()
+	template<typename T>
+	std::size_t findPool() const;
+
+	/// Pools, in creation order
+	std::vector<std::unique_ptr<ValuePoolIf> > pools;
+
+	/// Pool index by value type
+	std::unordered_map<std::type_index, std::size_t> poolIndexes;
+
+	/// Layout generation, changed by each allocation and release
+	std::uint64_t generation;
+};
+
+/**
+ * Parameter value storage
+ *
+ * Values are stored in the parameter unless the type is a scalar attached
+ * to a value arena. Arena values are compared bitwise, so long double, whose
+ * padding is unspecified, is kept in the parameter.
+ */
+template<typename T, typename Enable = void>
+struct ParamValueStorage {
+	typedef T Type;
+
+	static T& get(Type& storage, bool) {
+		return storage;
+	}
+
+	static const T& get(const Type& storage, bool) {
+		return storage;
+	}
+
+	static bool attach(Type&, ValueArena&, ParamIf*, const T&) {
+		return false;
+	}
+
+	static void detach(Type&, ValueArena&) {
+	}
+};
+
+template<typename T>
+struct ParamValueStorage<T, typename std::enable_if<std::is_arithmetic<T>::value &&
+		!std::is_same<T, long double>::value>::type> {
+	union Type {
+		explicit Type(const T& value) : inlineValue(value) {
+		}
+
+		T inlineValue;
+		T* arenaValue;
+	};
+
+	static T& get(Type& storage, bool inArena) {
+		return inArena ? *storage.arenaValue : storage.inlineValue;
+	}
+
+	static const T& get(const Type& storage, bool inArena) {
+		return inArena ? *storage.arenaValue : storage.inlineValue;
+	}
+
+	static bool attach(Type& storage, ValueArena& arena, ParamIf* owner, const T& defaultValue) {
+		storage.arenaValue = arena.allocate<T>(owner, storage.inlineValue, defaultValue);
+		return true;
+	}
+
+	static void detach(Type& storage, ValueArena& arena) {
+		T value = *storage.arenaValue;
+		arena.release<T>(storage.arenaValue);
+		storage.inlineValue = value;
+	}
+};
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#include "value-arena.hpp"
+
+#endif // HV_CONFIGURATION_VALUE_ARENA_H
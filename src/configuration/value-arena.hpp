@@ -0,0 +1,200 @@
+/*
+ * @file value-arena.hpp
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Contiguous storage of scalar parameter values implementation
+ */
+
+#ifndef HV_CONFIGURATION_VALUE_ARENA_IMPL_H
+#define HV_CONFIGURATION_VALUE_ARENA_IMPL_H
+
+#include <algorithm>
+#include <cstring>
+#include <typeinfo>
+
+#include "value-arena.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+template<typename T>
+ValuePool<T>::ValuePool() : chunks(), chunkIndexes(), freeSlots(), used(0) {
+}
+
+template<typename T>
+T* ValuePool<T>::allocate(ParamIf* owner, const T& value, const T& defaultValue) {
+	std::size_t slot;
+	if(!freeSlots.empty()) {
+		slot = freeSlots.back();
+		freeSlots.pop_back();
+	} else {
+		slot = used++;
+		if(slot / HV_CONFIGURATION_VALUE_ARENA_CHUNK_SIZE == chunks.size()) {
+			chunks.emplace_back(new Chunk());
+			chunkIndexes[chunks.back()->values] = chunks.size() - 1;
+		}
+	}
+	Chunk& chunk = *chunks[slot / HV_CONFIGURATION_VALUE_ARENA_CHUNK_SIZE];
+	const std::size_t index = slot % HV_CONFIGURATION_VALUE_ARENA_CHUNK_SIZE;
+	chunk.values[index] = value;
+	chunk.defaults[index] = defaultValue;
+	chunk.owners[index] = owner;
+	return &chunk.values[index];
+}
+
+template<typename T>
+bool ValuePool<T>::release(T* value) {
+	std::size_t slot;
+	if(!findSlot(value, slot)) {
+		return false;
+	}
+	Chunk& chunk = *chunks[slot / HV_CONFIGURATION_VALUE_ARENA_CHUNK_SIZE];
+	const std::size_t index = slot % HV_CONFIGURATION_VALUE_ARENA_CHUNK_SIZE;
+	chunk.values[index] = T();
+	chunk.defaults[index] = T();
+	chunk.owners[index] = nullptr;
+	freeSlots.push_back(slot);
+	return true;
+}
+
+template<typename T>
+bool ValuePool<T>::findSlot(const T* value, std::size_t& slot) const {
+	auto it = chunkIndexes.upper_bound(value);
+	if(it == chunkIndexes.begin()) {
+		return false;
+	}
+	--it;
+	const std::size_t index = static_cast<std::size_t>(value - it->first);
+	if(index >= HV_CONFIGURATION_VALUE_ARENA_CHUNK_SIZE) {
+		return false;
+	}
+	slot = it->second * HV_CONFIGURATION_VALUE_ARENA_CHUNK_SIZE + index;
+	return true;
+}
+
+template<typename T>
+std::size_t ValuePool<T>::size() const {
+	return used - freeSlots.size();
+}
+
+template<typename T>
+std::size_t ValuePool<T>::getChunkUsed(std::size_t index) const {
+	return std::min<std::size_t>(HV_CONFIGURATION_VALUE_ARENA_CHUNK_SIZE,
+			used - index * HV_CONFIGURATION_VALUE_ARENA_CHUNK_SIZE);
+}
+
+template<typename T>
+void ValuePool<T>::save(std::vector<char>& data) const {
+	data.resize(used * sizeof(T));
+	for(std::size_t i = 0; i < chunks.size(); ++i) {
+		std::memcpy(&data[i * HV_CONFIGURATION_VALUE_ARENA_CHUNK_SIZE * sizeof(T)], chunks[i]->values,
+				getChunkUsed(i) * sizeof(T));
+	}
+}
+
+template<typename T>
+void ValuePool<T>::restore(const std::vector<char>& data, std::vector<ParamIf*>& changed, bool apply) {
+	for(std::size_t i = 0; i < chunks.size(); ++i) {
+		Chunk& chunk = *chunks[i];
+		const std::size_t count = getChunkUsed(i);
+		const char* source = &data[i * HV_CONFIGURATION_VALUE_ARENA_CHUNK_SIZE * sizeof(T)];
+		if(std::memcmp(chunk.values, source, count * sizeof(T)) == 0) {
+			continue;
+		}
+		for(std::size_t j = 0; j < count; ++j) {
+			if(chunk.owners[j] && std::memcmp(&chunk.values[j], source + j * sizeof(T), sizeof(T)) != 0) {
+				changed.push_back(chunk.owners[j]);
+			}
+		}
+		if(apply) {
+			std::memcpy(chunk.values, source, count * sizeof(T));
+		}
+	}
+}
+
+template<typename T>
+void ValuePool<T>::resetToDefaults(std::vector<ParamIf*>& changed, bool apply) {
+	for(std::size_t i = 0; i < chunks.size(); ++i) {
+		Chunk& chunk = *chunks[i];
+		const std::size_t count = getChunkUsed(i);
+		if(std::memcmp(chunk.values, chunk.defaults, count * sizeof(T)) == 0) {
+			continue;
+		}
+		for(std::size_t j = 0; j < count; ++j) {
+			if(chunk.owners[j] && std::memcmp(&chunk.values[j], &chunk.defaults[j], sizeof(T)) != 0) {
+				changed.push_back(chunk.owners[j]);
+			}
+		}
+		if(apply) {
+			std::copy(chunk.defaults, chunk.defaults + count, chunk.values);
+		}
+	}
+}
+
+template<typename T>
+void ValuePool<T>::compare(const std::vector<char>& first, const std::vector<char>& second,
+		std::vector<ParamIf*>& changed) const {
+	for(std::size_t i = 0; i < chunks.size(); ++i) {
+		const Chunk& chunk = *chunks[i];
+		const std::size_t count = getChunkUsed(i);
+		const char* firstValues = &first[i * HV_CONFIGURATION_VALUE_ARENA_CHUNK_SIZE * sizeof(T)];
+		const char* secondValues = &second[i * HV_CONFIGURATION_VALUE_ARENA_CHUNK_SIZE * sizeof(T)];
+		if(std::memcmp(firstValues, secondValues, count * sizeof(T)) == 0) {
+			continue;
+		}
+		for(std::size_t j = 0; j < count; ++j) {
+			if(chunk.owners[j] && std::memcmp(firstValues + j * sizeof(T), secondValues + j * sizeof(T),
+					sizeof(T)) != 0) {
+				changed.push_back(chunk.owners[j]);
+			}
+		}
+	}
+}
+
+template<typename T>
+T* ValueArena::allocate(ParamIf* owner, const T& value, const T& defaultValue) {
+	generation++;
+	return getPool<T>().allocate(owner, value, defaultValue);
+}
+
+template<typename T>
+void ValueArena::release(T* value) {
+	if(getPool<T>().release(value)) {
+		generation++;
+	}
+}
+
+template<typename T>
+const T* ValueArena::findSnapshotValue(const Snapshot& snapshot, const T* value) const {
+	const std::size_t index = findPool<T>();
+	std::size_t slot;
+	if(snapshot.generation != generation || index >= snapshot.pools.size()
+			|| !static_cast<const ValuePool<T>&>(*pools[index]).findSlot(value, slot)
+			|| (slot + 1) * sizeof(T) > snapshot.pools[index].size()) {
+		return nullptr;
+	}
+	return reinterpret_cast<const T*>(&snapshot.pools[index][slot * sizeof(T)]);
+}
+
+template<typename T>
+std::size_t ValueArena::findPool() const {
+	auto it = poolIndexes.find(std::type_index(typeid(T)));
+	return it != poolIndexes.end() ? it->second : pools.size();
+}
+
+template<typename T>
+ValuePool<T>& ValueArena::getPool() {
+	auto it = poolIndexes.find(std::type_index(typeid(T)));
+	if(it != poolIndexes.end()) {
+		return static_cast<ValuePool<T>&>(*pools[it->second]);
+	}
+	ValuePool<T>* pool = new ValuePool<T>();
+	pools.emplace_back(pool);
+	poolIndexes[std::type_index(typeid(T))] = pools.size() - 1;
+	return *pool;
+}
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_VALUE_ARENA_IMPL_H
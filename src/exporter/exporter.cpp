@@ -0,0 +1,294 @@
+/*
+ * @file exporter.cpp
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Streaming configuration exporter
+ */
+
+#include "exporter.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+ExportWriter::ExportWriter(std::ostream& stream) :
+		stream(stream), buffer(HV_CONFIGURATION_EXPORT_BUFFER_SIZE), used(0), failed(false) {
+}
+
+ExportWriter::~ExportWriter() {
+	flush();
+}
+
+void ExportWriter::write(const char* data, std::size_t size) {
+	while(size) {
+		if(used == buffer.size()) {
+			flush();
+		}
+		std::size_t chunk = std::min(size, buffer.size() - used);
+		std::memcpy(&buffer[used], data, chunk);
+		used += chunk;
+		data += chunk;
+		size -= chunk;
+	}
+}
+
+bool ExportWriter::flush() {
+	if(used && !failed) {
+		stream.write(&buffer[0], static_cast<std::streamsize>(used));
+		if(!stream) {
+			HV_LOG_ERROR("Unable to write exported configuration");
+			failed = true;
+		}
+	}
+	used = 0;
+	return !failed;
+}
+
+bool ExportWriter::hasFailed() const {
+	return failed;
+}
+
+Exporter::Exporter(std::ostream& stream, const ExportOptions& options) :
+		writer(stream), options(options), path(), empty(1, true) {
+	if(options.format == EXPORT_JSON) {
+		writer.put('{');
+	}
+}
+
+const ExportOptions& Exporter::getOptions() const {
+	return options;
+}
+
+void Exporter::beginParam(const std::string& name) {
+	// Match the opened levels against the leading name segments
+	std::size_t begin = 0;
+	std::size_t depth = 0;
+	std::size_t end = name.find('.', begin);
+	while(end != std::string::npos && depth < path.size() &&
+			name.compare(begin, end - begin, path[depth]) == 0) {
+		depth++;
+		begin = end + 1;
+		end = name.find('.', begin);
+	}
+
+	while(path.size() > depth) {
+		closeLevel();
+		path.pop_back();
+	}
+
+	while(end != std::string::npos) {
+		path.push_back(name.substr(begin, end - begin));
+		openLevel(name.data() + begin, end - begin);
+		begin = end + 1;
+		end = name.find('.', begin);
+	}
+
+	if(options.metadata) {
+		openLevel(name.data() + begin, name.size() - begin);
+		writeKey("value", std::strlen("value"), false);
+	} else {
+		writeKey(name.data() + begin, name.size() - begin, false);
+	}
+}
+
+void Exporter::endParam() {
+	if(options.metadata) {
+		closeLevel();
+	}
+}
+
+bool Exporter::finish() {
+	while(!path.empty()) {
+		closeLevel();
+		path.pop_back();
+	}
+
+	if(options.format == EXPORT_JSON) {
+		if(!empty.back()) {
+			writer.put('\n');
+		}
+		writer.put('}');
+	} else if(empty.back()) {
+		writer.write("{}", 2);
+	}
+	writer.put('\n');
+	return writer.flush();
+}
+
+void Exporter::writeNull() {
+	writeToken("null", 4);
+}
+
+void Exporter::writeBool(bool value) {
+	if(value) {
+		writeToken("true", 4);
+	} else {
+		writeToken("false", 5);
+	}
+}
+
+void Exporter::writeInteger(std::int64_t value) {
+	char str[32];
+	int size = std::snprintf(str, sizeof(str), "%lld", static_cast<long long>(value));
+	writeToken(str, static_cast<std::size_t>(size));
+}
+
+void Exporter::writeUnsigned(std::uint64_t value) {
+	char str[32];
+	int size = std::snprintf(str, sizeof(str), "%llu", static_cast<unsigned long long>(value));
+	writeToken(str, static_cast<std::size_t>(size));
+}
+
+void Exporter::writeFloat(double value) {
+	if(std::isnan(value)) {
+		if(options.format == EXPORT_JSON) {
+			writeNull();
+		} else {
+			writeToken(".nan", 4);
+		}
+		return;
+	}
+	if(std::isinf(value)) {
+		if(options.format == EXPORT_JSON) {
+			writeNull();
+		} else if(value < 0) {
+			writeToken("-.inf", 5);
+		} else {
+			writeToken(".inf", 4);
+		}
+		return;
+	}
+
+	// Shortest of the usual precisions reading back the same value
+	char str[32];
+	int size = std::snprintf(str, sizeof(str), "%.15g", value);
+	if(std::strtod(str, nullptr) != value) {
+		size = std::snprintf(str, sizeof(str), "%.17g", value);
+	}
+	writeToken(str, static_cast<std::size_t>(size));
+}
+
+void Exporter::writeString(const std::string& value) {
+	writeQuoted(value.data(), value.size());
+}
+
+void Exporter::writeCCIValue(::cci::cci_value::const_reference value) {
+	// JSON is valid YAML flow content
+	const std::string json(value.to_json());
+	writeToken(json.data(), json.size());
+}
+
+void Exporter::writeMetadata(const ::cci::cci_value_map& metadata) {
+	if(options.metadata) {
+		writeKey("metadata", std::strlen("metadata"), false);
+		writeCCIValue(metadata);
+	}
+}
+
+void Exporter::writeKey(const char* key, std::size_t size, bool level) {
+	if(options.format == EXPORT_JSON) {
+		if(!empty.back()) {
+			writer.put(',');
+		}
+		writer.put('\n');
+		writeIndent();
+		writeQuoted(key, size);
+		writer.write(": ", 2);
+	} else {
+		if(!empty.front()) {
+			writer.put('\n');
+		}
+		writeIndent();
+
+		bool plain = size && key[0] != '-';
+		for(std::size_t i = 0; i < size && plain; ++i) {
+			const char c = key[i];
+			plain = (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') ||
+					(c >= '0' && c <= '9') || c == '_' || c == '-';
+		}
+		if(plain) {
+			writer.write(key, size);
+		} else {
+			writeQuoted(key, size);
+		}
+		writer.put(':');
+		if(!level) {
+			writer.put(' ');
+		}
+	}
+	empty.back() = false;
+}
+
+void Exporter::openLevel(const char* key, std::size_t size) {
+	writeKey(key, size, true);
+	if(options.format == EXPORT_JSON) {
+		writer.put('{');
+	}
+	empty.push_back(true);
+}
+
+void Exporter::closeLevel() {
+	const bool wasEmpty = empty.back();
+	empty.pop_back();
+	if(options.format == EXPORT_JSON) {
+		if(!wasEmpty) {
+			writer.put('\n');
+			writeIndent();
+		}
+		writer.put('}');
+	}
+}
+
+void Exporter::writeQuoted(const char* str, std::size_t size) {
+	// JSON escapes are valid in YAML double-quoted scalars
+	writer.put('"');
+	for(std::size_t i = 0; i < size; ++i) {
+		const char c = str[i];
+		switch(c) {
+		case '"':
+			writer.write("\\\"", 2);
+			break;
+		case '\\':
+			writer.write("\\\\", 2);
+			break;
+		case '\n':
+			writer.write("\\n", 2);
+			break;
+		case '\r':
+			writer.write("\\r", 2);
+			break;
+		case '\t':
+			writer.write("\\t", 2);
+			break;
+		default:
+			if(static_cast<unsigned char>(c) < 0x20) {
+				char escaped[8];
+				std::snprintf(escaped, sizeof(escaped), "\\u%04x", static_cast<unsigned int>(c));
+				writer.write(escaped, 6);
+			} else {
+				writer.put(c);
+			}
+		}
+	}
+	writer.put('"');
+}
+
+void Exporter::writeIndent() {
+	// JSON entries are nested in the root object, YAML ones are not
+	std::size_t depth = empty.size() - (options.format == EXPORT_JSON ? 0 : 1);
+	for(std::size_t i = 0; i < depth; ++i) {
+		writer.write("  ", 2);
+	}
+}
+
+void Exporter::writeToken(const char* token, std::size_t size) {
+	writer.write(token, size);
+}
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
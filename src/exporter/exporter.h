@@ -0,0 +1,203 @@
+/*
+ * @file exporter.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Streaming configuration exporter
+ */
+
+#ifndef HV_CONFIGURATION_EXPORTER_H
+#define HV_CONFIGURATION_EXPORTER_H
+
+#include "../configuration/common.h"
+
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <vector>
+
+#include <cci_configuration>
+
+/// Export buffer size in bytes
+#define HV_CONFIGURATION_EXPORT_BUFFER_SIZE (64 * 1024)
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+enum ExportFormat {
+	EXPORT_YAML,
+	EXPORT_JSON
+};
+
+/**
+ * Export options
+ */
+struct ExportOptions {
+	ExportOptions() :
+		format(EXPORT_YAML), nonDefaultOnly(false), presetOnly(false), metadata(false) {
+	}
+
+	/// Output format
+	ExportFormat format;
+
+	/// Only export parameters whose value differs from their default value
+	bool nonDefaultOnly;
+
+	/// Only export parameters having a preset value
+	bool presetOnly;
+
+	/// Export each parameter as a {value, metadata} entry
+	bool metadata;
+};
+
+/**
+ * Buffered stream writer
+ */
+class ExportWriter {
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param stream Output stream
+	 */
+	explicit ExportWriter(std::ostream& stream);
+
+	~ExportWriter();
+
+	ExportWriter(const ExportWriter&) HV_CPLUSPLUS_MEMBER_FUNCTION_DELETE;
+	ExportWriter& operator=(const ExportWriter&) HV_CPLUSPLUS_MEMBER_FUNCTION_DELETE;
+
+	/**
+	 * Write bytes
+	 *
+	 * @param data Data
+	 * @param size Data size in bytes
+	 */
+	void write(const char* data, std::size_t size);
+
+	/**
+	 * Write a character
+	 *
+	 * @param c Character
+	 */
+	void put(char c) {
+		if(used == buffer.size()) {
+			flush();
+		}
+		buffer[used++] = c;
+	}
+
+	/**
+	 * Write the buffered bytes to the stream
+	 *
+	 * @return True if every write succeeded so far, otherwise False
+	 */
+	bool flush();
+
+	/**
+	 * Indicates whether a write failed
+	 *
+	 * @return True if a write failed, otherwise False
+	 */
+	bool hasFailed() const;
+
+private:
+	std::ostream& stream;
+	std::vector<char> buffer;
+	std::size_t used;
+	bool failed;
+};
+
+/**
+ * Streaming configuration exporter
+ *
+ * Parameters must be given in name order. Hierarchy levels are opened and
+ * closed as the parameter names change, so that only the current path is kept
+ * in memory. Names which are both a parameter and a hierarchy level of
+ * another parameter yield duplicated keys.
+ */
+class Exporter {
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param stream Output stream
+	 * @param options Export options
+	 */
+	Exporter(std::ostream& stream, const ExportOptions& options);
+
+	/**
+	 * Get export options
+	 *
+	 * @return Export options
+	 */
+	const ExportOptions& getOptions() const;
+
+	/**
+	 * Start a parameter entry
+	 *
+	 * @param name Parameter hierarchical name
+	 */
+	void beginParam(const std::string& name);
+
+	/**
+	 * End a parameter entry
+	 */
+	void endParam();
+
+	/**
+	 * Close every hierarchy level and flush the output
+	 *
+	 * @return True if successful, otherwise False
+	 */
+	bool finish();
+
+	/// Write a null value
+	void writeNull();
+
+	/// Write a boolean value
+	void writeBool(bool value);
+
+	/// Write a signed integer value
+	void writeInteger(std::int64_t value);
+
+	/// Write an unsigned integer value
+	void writeUnsigned(std::uint64_t value);
+
+	/// Write a floating point value
+	void writeFloat(double value);
+
+	/// Write a string value
+	void writeString(const std::string& value);
+
+	/// Write a CCI value
+	void writeCCIValue(::cci::cci_value::const_reference value);
+
+	/**
+	 * Write parameter metadata (only when metadata are exported)
+	 *
+	 * @param metadata Metadata
+	 */
+	void writeMetadata(const ::cci::cci_value_map& metadata);
+
+private:
+	void writeKey(const char* key, std::size_t size, bool level);
+	void openLevel(const char* key, std::size_t size);
+	void closeLevel();
+	void writeQuoted(const char* str, std::size_t size);
+	void writeIndent();
+	void writeToken(const char* token, std::size_t size);
+
+	ExportWriter writer;
+	const ExportOptions options;
+
+	/// Currently opened hierarchy levels
+	std::vector<std::string> path;
+
+	/// Whether the current JSON object has no entry yet, one per opened object
+	std::vector<bool> empty;
+};
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_EXPORTER_H
@@ -0,0 +1,73 @@
+/*
+ * @file param-formatter.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Parameter value export formatting
+ */
+
+#ifndef HV_CONFIGURATION_PARAM_FORMATTER_H
+#define HV_CONFIGURATION_PARAM_FORMATTER_H
+
+#include "../configuration/common.h"
+#include "exporter.h"
+
+#include <string>
+#include <type_traits>
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+/**
+ * Parameter value formatter
+ *
+ * Generic types go through their CCI value converter. Scalars and strings
+ * are written directly, without building a CCI value.
+ */
+template<typename T, typename Enable = void>
+struct ParamFormatter {
+	static void format(Exporter& exporter, const T& value) {
+		exporter.writeCCIValue(::cci::cci_value(value));
+	}
+};
+
+template<>
+struct ParamFormatter<bool> {
+	static void format(Exporter& exporter, const bool& value) {
+		exporter.writeBool(value);
+	}
+};
+
+template<typename T>
+struct ParamFormatter<T, typename std::enable_if<std::is_integral<T>::value &&
+		std::is_signed<T>::value>::type> {
+	static void format(Exporter& exporter, const T& value) {
+		exporter.writeInteger(static_cast<std::int64_t>(value));
+	}
+};
+
+template<typename T>
+struct ParamFormatter<T, typename std::enable_if<std::is_integral<T>::value &&
+		std::is_unsigned<T>::value && !std::is_same<T, bool>::value>::type> {
+	static void format(Exporter& exporter, const T& value) {
+		exporter.writeUnsigned(static_cast<std::uint64_t>(value));
+	}
+};
+
+template<typename T>
+struct ParamFormatter<T, typename std::enable_if<std::is_floating_point<T>::value>::type> {
+	static void format(Exporter& exporter, const T& value) {
+		exporter.writeFloat(static_cast<double>(value));
+	}
+};
+
+template<>
+struct ParamFormatter<std::string> {
+	static void format(Exporter& exporter, const std::string& value) {
+		exporter.writeString(value);
+	}
+};
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_PARAM_FORMATTER_H
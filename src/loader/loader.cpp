@@ -7,16 +7,188 @@
  * @brief Loader implementation
  */
 
+#include <algorithm>
+#include <atomic>
+#include <exception>
+#include <memory>
+#include <thread>
+
+#include "../storage/storage-helper.h"
+#include "../storage/yaml/yaml.h"
 #include "loader.h"
 
 HV_CONFIGURATION_OPEN_NAMESPACE
 
+Loader::Loader() {
+}
+
 Loader::Loader(StorageIf* storage) {
-	storages.push_back(storage);
+	addSource(storage);
+	load();
+}
+
+Loader::Loader(std::vector<StorageIf*> storages) {
+	for(auto storage : storages) {
+		addSource(storage);
+	}
+	load();
+}
+
+void Loader::addSource(StorageIf* storage) {
+	if(storage) {
+		Source source;
+		source.storage = storage;
+		sources.push_back(source);
+	}
+}
+
+void Loader::addSource(const SourceFactory& factory) {
+	Source source;
+	source.storage = nullptr;
+	source.factory = factory;
+	sources.push_back(source);
+}
+
+void Loader::addYAML(const std::string& filepath) {
+	addSource([filepath]() -> StorageIf* {
+		// Never exit from a parsing thread: load() reports the failure
+		std::unique_ptr<YAML> yaml(new YAML(filepath, false));
+		return yaml->isLoaded() ? yaml.release() : nullptr;
+	});
+}
+
+bool Loader::load(unsigned int jobs) {
+	// Parse factory sources on a small thread pool
+	std::vector<std::size_t> pending;
+	for(std::size_t i = 0; i < sources.size(); ++i) {
+		if(!sources[i].storage) {
+			pending.push_back(i);
+		}
+	}
+	std::vector<std::unique_ptr<StorageIf> > parsed(sources.size());
+	std::vector<std::exception_ptr> errors(sources.size());
+
+	if(jobs == 0) {
+		jobs = std::max(1u, std::thread::hardware_concurrency());
+	}
+	jobs = static_cast<unsigned int>(std::min<std::size_t>(jobs, pending.size()));
+
+	std::atomic<std::size_t> next(0);
+	auto worker = [&]() {
+		for(std::size_t i = next++; i < pending.size(); i = next++) {
+			try {
+				parsed[pending[i]].reset(sources[pending[i]].factory());
+			} catch(...) {
+				errors[pending[i]] = std::current_exception();
+			}
+		}
+	};
+	std::vector<std::thread> workers;
+	for(unsigned int i = 1; i < jobs; ++i) {
+		workers.push_back(std::thread(worker));
+	}
+	if(jobs) {
+		worker();
+	}
+	for(auto &thread : workers) {
+		thread.join();
+	}
+	for(auto const &error : errors) {
+		if(error) {
+			std::rethrow_exception(error);
+		}
+	}
+
+	// Merge by increasing precedence
+	bool result = true;
+	storage.clear();
+	for(std::size_t i = 0; i < sources.size(); ++i) {
+		const StorageIf* source = sources[i].storage ? sources[i].storage : parsed[i].get();
+		if(!source) {
+			HV_LOG_ERROR("Loader source {} did not provide any storage", i);
+			result = false;
+			continue;
+		}
+		for(auto const &entry : source->getCCIValues("")) {
+			mergeValue(entry.first, entry.second);
+		}
+	}
+
+	HV_LOG_DEBUG("Loader: {} sources ({} parsed on {} threads) merged into {} keys",
+			sources.size(), pending.size(), jobs, storage.size());
+	return result;
+}
+
+void Loader::mergeValue(const std::string& key, const ::cci::cci_value& value) {
+	if(value.is_map()) {
+		// Flatten maps so that a higher layer only overrides the leaves it defines
+		storage.erase(key);
+		for(auto const &entry : value.get_map()) {
+			mergeValue(key + HV_CONFIGURATION_STORAGE_SEPARATOR + std::string(entry.key), entry.value);
+		}
+	} else {
+		eraseStorageValue(storage, key);
+		storage[key] = value;
+	}
+}
+
+void Loader::setValue(const std::string& key, const std::string& value) {
+	setStorageValue(storage, key, parseStorageValue(value));
+}
+
+std::string Loader::getValue(const std::string& key) const {
+	::cci::cci_value value;
+	if(findStorageValue(storage, key, value)) {
+		return formatStorageValue(value);
+	} else {
+		return std::string();
+	}
+}
+
+std::map<std::string, std::string> Loader::getValues(const std::string& keyPrefix) const {
+	std::map<std::string, std::string> result;
+	for(auto const &entry : storage) {
+		if (keyPrefix.empty() || entry.first.find(keyPrefix) != std::string::npos) {
+			result.insert(result.end(), std::make_pair(entry.first, formatStorageValue(entry.second)));
+		}
+	}
+	return result;
+}
+
+bool Loader::hasValue(const std::string& key) const {
+	return hasStorageValue(storage, key);
+}
+
+void Loader::deleteValue(const std::string& key) {
+	eraseStorageValue(storage, key);
+}
+
+bool Loader::reset() {
+	storage.clear();
+	return true;
+}
+
+::cci::cci_value Loader::getCCIValue(const std::string& key) const {
+	::cci::cci_value value;
+	findStorageValue(storage, key, value);
+	return value;
+}
+
+void Loader::setCCIValue(const std::string& key, const ::cci::cci_value& value) {
+	setStorageValue(storage, key, value);
 }
 
-Loader::Loader(std::vector<StorageIf*> storages) :
-	storages(storages) {
+std::map<std::string, ::cci::cci_value> Loader::getCCIValues(const std::string& keyPrefix) const {
+	if(keyPrefix.empty()) {
+		return storage;
+	}
+	std::map<std::string, ::cci::cci_value> result;
+	for(auto const &entry : storage) {
+		if (entry.first.find(keyPrefix) != std::string::npos) {
+			result.insert(result.end(), entry);
+		}
+	}
+	return result;
 }
 
 HV_CONFIGURATION_CLOSE_NAMESPACE
@@ -13,18 +13,97 @@
 #include "../configuration/common.h"
 #include "../storage/storage-if.h"
 
+#include <functional>
+#include <map>
 #include <vector>
 
 HV_CONFIGURATION_OPEN_NAMESPACE
 
-class Loader {
+/**
+ * Layered configuration source
+ *
+ * Sources are ordered by precedence: a source added later overrides the
+ * previous ones. Sources provided as factories are parsed concurrently by
+ * load(), then all sources are merged into a single indexed store.
+ */
+class Loader : public StorageIf {
 public:
+	/// Source factory, the returned storage is owned by the loader
+	typedef std::function<StorageIf*()> SourceFactory;
+
+	Loader();
+
 	Loader(StorageIf* storage);
 
 	Loader(std::vector<StorageIf*> storages);
 
+	~Loader() override HV_CPLUSPLUS_MEMBER_FUNCTION_DEFAULT;
+
+	/**
+	 * Add an already loaded source
+	 *
+	 * @param storage Storage (not owned)
+	 */
+	void addSource(StorageIf* storage);
+
+	/**
+	 * Add a source parsed during load()
+	 *
+	 * @param factory Storage factory
+	 */
+	void addSource(const SourceFactory& factory);
+
+	/**
+	 * Add a YAML file parsed during load()
+	 *
+	 * A file which cannot be loaded makes load() fail instead of exiting.
+	 *
+	 * @param filepath YAML file path
+	 */
+	void addYAML(const std::string& filepath);
+
+	/**
+	 * Parse sources concurrently then merge them by precedence
+	 *
+	 * @param jobs Maximum number of parsing threads (0: hardware concurrency)
+	 * @return True if every source provided a storage, otherwise False
+	 */
+	bool load(unsigned int jobs = 0);
+
+public:
+	void setValue(const std::string& key, const std::string& value) override;
+
+	std::string getValue(const std::string& key) const override;
+
+	std::map<std::string, std::string> getValues(const std::string& keyPrefix) const override;
+
+	bool hasValue(const std::string& key) const override;
+
+	void deleteValue(const std::string& key) override;
+
+	bool reset() override;
+
+	::cci::cci_value getCCIValue(const std::string& key) const override;
+
+	void setCCIValue(const std::string& key, const ::cci::cci_value& value) override;
+
+	std::map<std::string, ::cci::cci_value> getCCIValues(const std::string& keyPrefix) const override;
+
+protected:
+	void mergeValue(const std::string& key, const ::cci::cci_value& value);
+
 private:
-	std::vector<StorageIf*> storages;
+	/// Source: either an already loaded storage or a factory
+	struct Source {
+		StorageIf* storage;
+		SourceFactory factory;
+	};
+
+	/// Sources, by increasing precedence
+	std::vector<Source> sources;
+
+	/// Merged leaves by flat key, maps are rebuilt from their leaves
+	std::map<std::string, ::cci::cci_value> storage;
 };
 
 HV_CONFIGURATION_CLOSE_NAMESPACE
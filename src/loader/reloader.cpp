@@ -0,0 +1,225 @@
+/*
+ * @file reloader.cpp
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Live YAML configuration reloader
+ */
+
+#include "../storage/storage-helper.h"
+#include "../storage/yaml/yaml.h"
+#include "reloader.h"
+
+#include <algorithm>
+
+#if defined(__linux__)
+#include <poll.h>
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+/// Watcher thread polling period, in milliseconds
+#define HV_CONFIGURATION_RELOADER_POLL_PERIOD 200
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+Reloader::Reloader(const std::string& filepath, const char* name) :
+		Reloader(filepath,
+				findBrokerConvenience(::cci::cci_originator(std::string(name))),
+				name) {
+}
+
+Reloader::Reloader(const std::string& filepath,
+		::cci::cci_broker_handle broker,
+		const char* name) :
+		sc_core::sc_prim_channel(name),
+		filepath(filepath),
+		broker(broker),
+		running(false) {
+	YAML yaml(filepath, false);
+	values = std::make_shared<const std::map<std::string, ::cci::cci_value> >(yaml.getCCIValues(""));
+}
+
+Reloader::~Reloader() {
+	stop();
+}
+
+bool Reloader::start() {
+#if defined(__linux__)
+	if(running) {
+		return true;
+	}
+	// A watcher which stopped on its own (watch() failure) is still joinable
+	if(watcher.joinable()) {
+		watcher.join();
+	}
+	running = true;
+	watcher = std::thread(&Reloader::watch, this);
+	return true;
+#else
+	HV_LOG_ERROR("File watching is not supported on this platform, call reload() to apply {}", filepath);
+	return false;
+#endif
+}
+
+void Reloader::stop() {
+	running = false;
+	if(watcher.joinable()) {
+		watcher.join();
+	}
+}
+
+std::size_t Reloader::reload() {
+	YAML yaml(filepath, false);
+	if(!yaml.isLoaded()) {
+		HV_LOG_ERROR("Unable to reload {}, keeping the previous configuration", filepath);
+		return 0;
+	}
+	std::shared_ptr<const std::map<std::string, ::cci::cci_value> > newValues =
+			std::make_shared<const std::map<std::string, ::cci::cci_value> >(yaml.getCCIValues(""));
+
+	// Both key sets are sorted: diff them in a single pass
+	std::vector<std::string> changedKeys;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		std::map<std::string, ::cci::cci_value>::const_iterator oldIt = values->begin();
+		for(auto const &entry : *newValues) {
+			while(oldIt != values->end() && oldIt->first < entry.first) {
+				HV_LOG_DEBUG("Reloader: {} has been removed from {}, ignored", oldIt->first, filepath);
+				++oldIt;
+			}
+			if(oldIt == values->end() || oldIt->first != entry.first || oldIt->second != entry.second) {
+				changedKeys.push_back(entry.first);
+			}
+		}
+		values = newValues;
+		if(!changedKeys.empty()) {
+			pendingKeys.insert(pendingKeys.end(), changedKeys.begin(), changedKeys.end());
+			pendingValues = newValues;
+		}
+	}
+
+	HV_LOG_DEBUG("Reloader: {} changed keys in {}", changedKeys.size(), filepath);
+	if(!changedKeys.empty()) {
+		async_request_update();
+	}
+	return changedKeys.size();
+}
+
+void Reloader::update() {
+	std::vector<std::string> keys;
+	std::shared_ptr<const std::map<std::string, ::cci::cci_value> > keyValues;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		keys.swap(pendingKeys);
+		keyValues = pendingValues;
+		pendingValues.reset();
+	}
+	if(!keyValues) {
+		return;
+	}
+
+	std::vector<std::string> appliedParams;
+	for(auto const &key : keys) {
+		apply(key, *keyValues, appliedParams);
+	}
+}
+
+void Reloader::apply(const std::string& key,
+		const std::map<std::string, ::cci::cci_value>& keyValues,
+		std::vector<std::string>& appliedParams) {
+	// The key may be a leaf of a structured parameter: look for the closest parameter
+	std::string paramName = key;
+	::cci::cci_param_untyped_handle handle = broker.get_param_handle(paramName);
+	std::string parentName = key;
+	std::string::size_type separator;
+	while(!handle.is_valid() &&
+			(separator = parentName.rfind(HV_CONFIGURATION_STORAGE_SEPARATOR)) != std::string::npos) {
+		parentName.resize(separator);
+		::cci::cci_param_untyped_handle parent = broker.get_param_handle(parentName);
+		if(parent.is_valid()) {
+			// Only a map-typed parameter holds leaves, the key of any other one is a preset
+			if(parent.get_data_category() == ::cci::CCI_OTHER_PARAM && parent.get_cci_value().is_map()) {
+				handle = parent;
+				paramName = parentName;
+			}
+			break;
+		}
+	}
+
+	if(!handle.is_valid()) {
+		// No parameter yet, the value will be used at parameter creation
+		std::map<std::string, ::cci::cci_value>::const_iterator it = keyValues.find(key);
+		if(it != keyValues.end()) {
+			HV_LOG_DEBUG("Reloader: preset {} = {}", key, it->second.to_json());
+			broker.set_preset_cci_value(key, it->second);
+		}
+		return;
+	}
+
+	// A structured parameter is written once, whatever the number of changed leaves
+	if(std::find(appliedParams.begin(), appliedParams.end(), paramName) != appliedParams.end()) {
+		return;
+	}
+	appliedParams.push_back(paramName);
+
+	if(handle.is_locked()) {
+		HV_LOG_WARNING("Reloader: {} is locked, change ignored", paramName);
+		return;
+	}
+	::cci::cci_value value;
+	if(findStorageValue(keyValues, paramName, value)) {
+		HV_LOG_DEBUG("Reloader: {} = {}", paramName, value.to_json());
+		handle.set_cci_value(value);
+	}
+}
+
+void Reloader::watch() {
+#if defined(__linux__)
+	// Editors usually replace the file: watch its directory
+	std::string::size_type separator = filepath.rfind('/');
+	const std::string directory = (separator == std::string::npos) ? "." : filepath.substr(0, separator + 1);
+	const std::string filename = (separator == std::string::npos) ? filepath : filepath.substr(separator + 1);
+
+	int fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if(fd < 0) {
+		HV_LOG_ERROR("Unable to initialize inotify to watch {}", filepath);
+		running = false;
+		return;
+	}
+	if(inotify_add_watch(fd, directory.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) < 0) {
+		HV_LOG_ERROR("Unable to watch {}", directory);
+		close(fd);
+		running = false;
+		return;
+	}
+
+	char buffer[4096] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+	while(running) {
+		struct pollfd pfd;
+		pfd.fd = fd;
+		pfd.events = POLLIN;
+		if(poll(&pfd, 1, HV_CONFIGURATION_RELOADER_POLL_PERIOD) <= 0) {
+			continue;
+		}
+		bool changed = false;
+		ssize_t length;
+		while((length = read(fd, buffer, sizeof(buffer))) > 0) {
+			for(char* ptr = buffer; ptr < buffer + length;) {
+				const struct inotify_event* event = reinterpret_cast<const struct inotify_event*>(ptr);
+				if(event->len && filename == event->name) {
+					changed = true;
+				}
+				ptr += sizeof(struct inotify_event) + event->len;
+			}
+		}
+		if(changed) {
+			reload();
+		}
+	}
+	close(fd);
+#endif
+}
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
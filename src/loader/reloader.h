@@ -0,0 +1,119 @@
+/*
+ * @file reloader.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Live YAML configuration reloader
+ */
+
+#ifndef HV_CONFIGURATION_RELOADER_H
+#define HV_CONFIGURATION_RELOADER_H
+
+#include "../configuration/common.h"
+#include "../configuration/common-cci.h"
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include <systemc>
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+/**
+ * Live YAML configuration reloader
+ *
+ * A watcher thread waits for modifications of the YAML file (inotify), parses
+ * it again and diffs it against the previous key set. Only the changed keys
+ * are applied, from the update phase of the SystemC kernel (delta-cycle
+ * boundary): existing parameters are written through their CCI handle so
+ * that the usual callbacks run, other keys become presets.
+ */
+class Reloader : public sc_core::sc_prim_channel {
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param filepath YAML file path
+	 * @param name Channel name
+	 */
+	explicit Reloader(const std::string& filepath,
+			const char* name = sc_core::sc_gen_unique_name("hv_cfg_reloader"));
+
+	/**
+	 * Constructor
+	 *
+	 * @param filepath YAML file path
+	 * @param broker Broker receiving the changes
+	 * @param name Channel name
+	 */
+	Reloader(const std::string& filepath,
+			::cci::cci_broker_handle broker,
+			const char* name = sc_core::sc_gen_unique_name("hv_cfg_reloader"));
+
+	~Reloader() override;
+
+	/**
+	 * Start watching the file
+	 *
+	 * @return True if the watcher has been started, otherwise False
+	 */
+	bool start();
+
+	/**
+	 * Stop watching the file
+	 */
+	void stop();
+
+	/**
+	 * Parse the file again and queue the changed keys
+	 *
+	 * Thread safe: changes are applied at the next update phase.
+	 *
+	 * @return Number of changed keys
+	 */
+	std::size_t reload();
+
+protected:
+	/// Apply queued changes
+	void update() override;
+
+	void watch();
+
+	void apply(const std::string& key,
+			const std::map<std::string, ::cci::cci_value>& values,
+			std::vector<std::string>& appliedParams);
+
+private:
+	/// Watched file path
+	const std::string filepath;
+
+	/// Broker handle
+	::cci::cci_broker_handle broker;
+
+	/// Latest key set
+	std::shared_ptr<const std::map<std::string, ::cci::cci_value> > values;
+
+	/// Changed keys waiting for the update phase
+	std::vector<std::string> pendingKeys;
+
+	/// Key set the pending keys refer to
+	std::shared_ptr<const std::map<std::string, ::cci::cci_value> > pendingValues;
+
+	/// Protects pending changes and key sets
+	std::mutex mutex;
+
+	/// Watcher thread
+	std::thread watcher;
+
+	/// Whether the watcher thread runs
+	std::atomic<bool> running;
+};
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_RELOADER_H
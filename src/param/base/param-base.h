@@ -10,12 +10,20 @@
 #ifndef HV_CONFIGURATION_PARAM_BASE_H
 #define HV_CONFIGURATION_PARAM_BASE_H
 
+#include <algorithm>
+#include <cstdint>
 #include <iostream>
+#include <memory>
 #include <vector>
 
 #include "../../configuration/common.h"
 #include "../../configuration/common-cci.h"
+#include "../../configuration/description-pool.h"
+#include "../../configuration/value-arena.h"
 #include "../param-if.h"
+#include "../../checkpoint/config-snapshot.h"
+#include "../../checkpoint/param-serializer.h"
+#include "../../exporter/param-formatter.h"
 
 HV_CONFIGURATION_OPEN_NAMESPACE
 
@@ -82,7 +90,7 @@ public:
 	 *
 	 * @return True if it is the default value, otherwise False
 	 */
-	bool isDefaultValue() const;
+	virtual bool isDefaultValue() const override;
 
 	/**
      * Set human readable parameter description
@@ -94,9 +102,33 @@ public:
 	/**
 	 * Get the parameter's description
 	 *
-     * @return Parameter description
+     * @return Parameter description, shared with parameters of identical description
      */
-	virtual std::string getDescription() const;
+	virtual const std::string& getDescription() const;
+
+	/// @copydoc ParamIf::saveState
+	virtual void saveState(CheckpointWriter& writer) const override;
+
+	/// @copydoc ParamIf::restoreState
+	virtual bool restoreState(CheckpointReader& reader) override;
+
+	/// @copydoc ParamIf::exportParam
+	virtual void exportParam(Exporter& exporter) const override;
+
+	/// @copydoc ParamIf::isDirty
+	virtual bool isDirty() const override;
+
+	/// @copydoc ParamIf::markDirty
+	virtual void markDirty() override;
+
+	/// @copydoc ParamIf::clearDirty
+	virtual void clearDirty() override;
+
+	/// @copydoc ParamIf::getDirtyIndex
+	virtual std::size_t getDirtyIndex() const override;
+
+	/// @copydoc ParamIf::setDirtyIndex
+	virtual void setDirtyIndex(std::size_t index) override;
 
 	/**
 	 * Reset the parameter to its default value
@@ -105,6 +137,21 @@ public:
      */
 	virtual bool reset();
 
+	/// @copydoc ParamIf::resetValue
+	virtual bool resetValue(ResetMode mode, ResetPolicy policy, const ConfigSnapshot* snapshot) override;
+
+	/// @copydoc ParamIf::copyValue
+	virtual ParamValueIf* copyValue() const override;
+
+	/// @copydoc ParamIf::getSnapshotCCIValue
+	virtual ::cci::cci_value getSnapshotCCIValue(const ConfigSnapshot& snapshot) const override;
+
+	/// @copydoc ParamIf::isInValueArena
+	virtual bool isInValueArena() const override;
+
+	/// @copydoc ParamIf::detachBroker
+	virtual void detachBroker() override;
+
 	/**
 	 * Indicates whether the parameter has registered callbacks
 	 *
@@ -249,65 +296,164 @@ protected:
 protected:
 	void init();
 
-	void runPreReadCallbacks(const T& value) const;
+	/// Get the stored value, bypassing callbacks
+	T& valueRef();
+
+	/**
+	 * Get the preset value
+	 *
+	 * @return Preset value, null if there is none
+	 */
+	virtual const T* getPresetValue() const;
+
+	/// Get the value of the parameter in a snapshot, null if there is none
+	const T* findSnapshotValue(const ConfigSnapshot* snapshot) const;
+
+	/**
+	 * Indicates whether writes through the write path are refused
+	 *
+	 * @return True if the parameter is locked, otherwise False
+	 */
+	virtual bool isWriteLocked() const;
+
+	/// @copydoc valueRef
+	const T& valueRef() const;
+
+	/*
+	 * Callback dispatch. The originator is the reader or the writer, null for
+	 * accesses through the HV API (the parameter originator is used).
+	 */
+	void runPreReadCallbacks(const T& value,
+			const ::cci::cci_originator* originator = nullptr) const;
 
-	void runPostReadCallbacks(const T& value) const;
+	void runPostReadCallbacks(const T& value,
+			const ::cci::cci_originator* originator = nullptr) const;
 
-	bool runPreWriteCallbacks(const T& value) const;
+	bool runPreWriteCallbacks(const T& value,
+			const ::cci::cci_originator* originator = nullptr) const;
 
-	void runPostWriteCallbacks(const T& oldValue, const T& newValue) const;
+	void runPostWriteCallbacks(const T& oldValue, const T& newValue,
+			const ::cci::cci_originator* originator = nullptr) const;
 
 protected:
 	/// Parameter name
 	std::string name;
 
-	/// Parameter value
-	T value;
+	/// Parameter value, possibly stored in the broker value arena
+	typename ParamValueStorage<T>::Type valueStorage;
 
 	/// Parameter default value
 	T defaultValue;
 
-	/// Parameter description
-	std::string description;
+	/// Associated CCI parameter, target of CCI callback events
+	::cci::cci_param_if* cciParam;
+
+	/// Interned parameter description, null if there is none
+	DescriptionPtr description;
+
+	/// Broker the parameter is registered into, null if there is none
+	Broker* broker;
 
 private:
-	/// Callback vector item
+	/**
+	 * Ordered callback list of one event kind
+	 *
+	 * HV callbacks and CCI callbacks share the list and are dispatched in
+	 * registration order. Entries are shared so that a callback can register or
+	 * unregister callbacks while the list is dispatched.
+	 */
 	template<typename U>
-	class CallbackMap {
+	class CallbackList {
 	public:
-		CallbackMap() :
-			inUse(false) {
+		struct Entry {
+			/// HV callback ID (HV entries)
+			::hv::common::hvcbID_t id;
+
+			/// HV callback (HV entries)
+			U callback;
+
+			/// CCI callback (CCI entries)
+			::cci::cci_callback_untyped_handle cciCallback;
+
+			/// CCI callback originator (CCI entries)
+			OriginatorId originatorId;
+
+			/// Whether this is a CCI entry
+			bool cci;
+		};
+
+		CallbackList() :
+			entries(), inUse(false) {
 		};
 
 		void setCb(::hv::common::hvcbID_t id, U cb) {
 			if(!hasID(id)) {
-				map.insert(std::pair<::hv::common::hvcbID_t, U>(id, cb));
-				//map[id] = cb;
+				std::shared_ptr<Entry> entry(new Entry());
+				entry->id = id;
+				entry->callback = cb;
+				entry->cci = false;
+				entries.push_back(entry);
 			} else {
 				HV_LOG_ERROR("A callback with this ID is already registered.");
 			}
 		}
 
+		void setCCICb(const ::cci::cci_callback_untyped_handle& cb, OriginatorId originatorId) {
+			std::shared_ptr<Entry> entry(new Entry());
+			entry->cciCallback = cb;
+			entry->originatorId = originatorId;
+			entry->cci = true;
+			entries.push_back(entry);
+		}
+
 		bool hasID(::hv::common::hvcbID_t id) const {
-			return map.find(id) != map.end() ;
+			for(auto const &entry : entries) {
+				if(!entry->cci && entry->id == id) {
+					return true;
+				}
+			}
+			return false;
 		}
 
 		void erase(::hv::common::hvcbID_t id) {
-			if(hasID(id)) {
-				map.erase(id);
+			for(auto it = entries.begin(); it != entries.end(); ++it) {
+				if(!(*it)->cci && (*it)->id == id) {
+					entries.erase(it);
+					return;
+				}
+			}
+		}
+
+		bool eraseCCI(const ::cci::cci_callback_untyped_handle& cb, OriginatorId originatorId) {
+			for(auto it = entries.begin(); it != entries.end(); ++it) {
+				if((*it)->cci && (*it)->cciCallback == cb && (*it)->originatorId == originatorId) {
+					entries.erase(it);
+					return true;
+				}
 			}
+			return false;
 		}
 
 		bool isEmpty() const {
-			return map.empty();
+			return entries.empty();
 		}
 
+		/// Remove HV entries
 		void clear() {
-			map.clear();
+			removeIf(false, 0, false);
+		}
+
+		/// Remove CCI entries registered by an originator
+		bool clearCCI(OriginatorId originatorId) {
+			return removeIf(true, originatorId, true);
 		}
 
-		std::map<::hv::common::hvcbID_t, U> getMap() const {
-			return map;
+		std::size_t size() const {
+			return entries.size();
+		}
+
+		std::shared_ptr<const Entry> get(std::size_t index) const {
+			return entries[index];
 		}
 
 		void setUsing(bool inUse) const {
@@ -318,24 +464,69 @@ private:
 			return this->inUse;
 		}
 	private:
-		std::map<::hv::common::hvcbID_t, U> map;
+		bool removeIf(bool cci, OriginatorId originatorId, bool checkOriginator) {
+			std::size_t count = entries.size();
+			entries.erase(std::remove_if(entries.begin(), entries.end(),
+					[&](const std::shared_ptr<Entry>& entry) {
+				return entry->cci == cci && (!checkOriginator || entry->originatorId == originatorId);
+			}), entries.end());
+			return entries.size() != count;
+		}
+
+		std::vector<std::shared_ptr<Entry> > entries;
 		mutable bool inUse;
 	};
 
-	/// Pre read callbacks
-	CallbackMap<PreReadCallback<T> > preReadCallbacks;
+	/**
+	 * Rarely used parameter state, allocated on first use
+	 */
+	struct ColdState {
+		ColdState() :
+			preReadCallbacks(), postReadCallbacks(), preWriteCallbacks(),
+			postWriteCallbacks(), cbIDCpt(0) {
+		}
+
+		/// Pre read callbacks
+		CallbackList<PreReadCallback<T> > preReadCallbacks;
 
-	/// Post read callbacks
-	CallbackMap<PostReadCallback<T> > postReadCallbacks;
+		/// Post read callbacks
+		CallbackList<PostReadCallback<T> > postReadCallbacks;
 
-	/// Pre write callbacks
-	CallbackMap<PreWriteCallback<T> > preWriteCallbacks;
+		/// Pre write callbacks
+		CallbackList<PreWriteCallback<T> > preWriteCallbacks;
 
-	/// Post write callbacks
-	CallbackMap<PostWriteCallback<T> > postWriteCallbacks;
+		/// Post write callbacks
+		CallbackList<PostWriteCallback<T> > postWriteCallbacks;
 
-	/// Callback ID counter
-	::hv::common::hvcbID_t cbIDCpt;
+		/// Callback ID counter
+		::hv::common::hvcbID_t cbIDCpt;
+	};
+
+	/**
+	 * Get the cold state, allocating it if needed
+	 *
+	 * @return Cold state
+	 */
+	ColdState& getColdState();
+
+	/// Parameter flags
+	enum Flag {
+		/// The value changed since the last checkpoint
+		FLAG_DIRTY = 1 << 0,
+		/// The value is stored in the broker value arena
+		FLAG_ARENA = 1 << 1
+	};
+
+	/// Cold state, null until first used
+	std::unique_ptr<ColdState> cold;
+
+protected:
+	/// Parameter flags (Flag)
+	std::uint8_t flags;
+
+private:
+	/// Position in the broker dirty list, meaningful while FLAG_DIRTY is set
+	std::uint32_t dirtyIndex;
 };
 
 HV_CONFIGURATION_CLOSE_NAMESPACE
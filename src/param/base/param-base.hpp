@@ -16,39 +16,91 @@ HV_CONFIGURATION_OPEN_NAMESPACE
 
 template<typename T>
 ParamBase<T>::ParamBase(const std::string& name, const T& defaultValue):
-	name(name), value(defaultValue), defaultValue(defaultValue), cbIDCpt(0) {
+	name(name), valueStorage(defaultValue), defaultValue(defaultValue), cciParam(nullptr),
+	description(nullptr), broker(nullptr), cold(), flags(0), dirtyIndex(0) {
 	init();
 }
 
 template<typename T>
 ParamBase<T>::ParamBase(const std::string& name, const T& defaultValue, const std::string& description):
-		name(name), value(defaultValue), defaultValue(defaultValue), description(description), cbIDCpt(0) {
+		name(name), valueStorage(defaultValue), defaultValue(defaultValue), cciParam(nullptr),
+		description(internDescription(description)), broker(nullptr), cold(), flags(0), dirtyIndex(0) {
 	init();
 }
 
 template<typename T>
 ParamBase<T>::ParamBase(const ParamBase &paramBase):
 		name(paramBase.name),
-		value(paramBase.value),
+		valueStorage(paramBase.valueRef()),
 		defaultValue(paramBase.defaultValue),
+		cciParam(nullptr),
 		description(paramBase.description),
-		cbIDCpt(paramBase.cbIDCpt) {
+		broker(nullptr),
+		cold(),
+		flags(0),
+		dirtyIndex(0) {
+	if(paramBase.cold) {
+		getColdState().cbIDCpt = paramBase.cold->cbIDCpt;
+	}
 }
 
 template<typename T>
 void ParamBase<T>::init() {
 	// Hiventive parameter do not support parameter destruction / resurrection.
 	// We only support relative unique name if not used by CCI
-	std::string hierarchicalUniqueName = generateRelativeUniqueName(name);
+	name = generateAndRegisterUniqueName(name);
+
+	HV_LOG_TRACE("Initialiazing {}", name);
+
+	broker = _registerParam(this);
+
+	ValueArena* arena = broker ? _getValueArena(broker) : nullptr;
+	if(arena && ParamValueStorage<T>::attach(valueStorage, *arena, this, defaultValue)) {
+		flags |= FLAG_ARENA;
+	}
+
+	// A new parameter is not part of any previous checkpoint
+	markDirty();
+}
 
-	HV_LOG_TRACE("Initialiazing {}", hierarchicalUniqueName);
+template<typename T>
+T& ParamBase<T>::valueRef() {
+	return ParamValueStorage<T>::get(valueStorage, flags & FLAG_ARENA);
+}
 
-	registerName(hierarchicalUniqueName);
+template<typename T>
+const T& ParamBase<T>::valueRef() const {
+	return ParamValueStorage<T>::get(valueStorage, flags & FLAG_ARENA);
+}
 
-	// We set hierarchicalUniqueName
-	name = hierarchicalUniqueName;
+template<typename T>
+void ParamBase<T>::markDirty() {
+	if(!(flags & FLAG_DIRTY)) {
+		flags |= FLAG_DIRTY;
+		if(broker) {
+			_markParamDirty(broker, this);
+		}
+	}
+}
+
+template<typename T>
+bool ParamBase<T>::isDirty() const {
+	return flags & FLAG_DIRTY;
+}
+
+template<typename T>
+void ParamBase<T>::clearDirty() {
+	flags &= ~FLAG_DIRTY;
+}
+
+template<typename T>
+std::size_t ParamBase<T>::getDirtyIndex() const {
+	return dirtyIndex;
+}
 
-	_registerParam(this);
+template<typename T>
+void ParamBase<T>::setDirtyIndex(std::size_t index) {
+	dirtyIndex = static_cast<std::uint32_t>(index);
 }
 
 template<typename T>
@@ -63,18 +115,19 @@ void ParamBase<T>::setName(const std::string& name) {
 
 template<typename T>
 void ParamBase<T>::setValue(const T& value) {
-	T oldValue = this->value;
+	T oldValue = valueRef();
 	if(runPreWriteCallbacks(value)) {
-		this->value = value;
+		valueRef() = value;
+		markDirty();
 	}
 	runPostWriteCallbacks(oldValue, value);
 }
 
 template<typename T>
 const T& ParamBase<T>::getValue() const {
-	runPreReadCallbacks(value);
-	const T* tmpValue = &value;
-	runPostReadCallbacks(value);
+	const T* tmpValue = &valueRef();
+	runPreReadCallbacks(*tmpValue);
+	runPostReadCallbacks(*tmpValue);
 	return *tmpValue;
 }
 
@@ -102,37 +155,132 @@ const T& ParamBase<T>::getDefaultValue() const {
 
 template<typename T>
 bool ParamBase<T>::isDefaultValue() const {
-	return value == defaultValue;
+	return valueRef() == defaultValue;
 }
 
 template<typename T>
 void ParamBase<T>::setDescription(const std::string& description) {
-	this->description = description;
+	this->description = internDescription(description);
+}
+
+template<typename T>
+const std::string& ParamBase<T>::getDescription() const {
+	return getInternedDescription(description);
+}
+
+template<typename T>
+void ParamBase<T>::saveState(CheckpointWriter& writer) const {
+	ParamSerializer<T>::save(writer, valueRef());
+}
+
+template<typename T>
+bool ParamBase<T>::restoreState(CheckpointReader& reader) {
+	return ParamSerializer<T>::restore(reader, valueRef());
 }
 
 template<typename T>
-std::string ParamBase<T>::getDescription() const {
-	return description;
+void ParamBase<T>::exportParam(Exporter& exporter) const {
+	ParamFormatter<T>::format(exporter, valueRef());
 }
 
 template<typename T>
 bool ParamBase<T>::reset() {
-	value = defaultValue;
+	valueRef() = defaultValue;
+	markDirty();
+	return true;
+}
+
+template<typename T>
+bool ParamBase<T>::resetValue(ResetMode mode, ResetPolicy policy, const ConfigSnapshot* snapshot) {
+	const T* target = &defaultValue;
+	if(mode == RESET_PRESET) {
+		const T* presetValue = getPresetValue();
+		if(presetValue) {
+			target = presetValue;
+		}
+	} else if(mode == RESET_SNAPSHOT) {
+		target = findSnapshotValue(snapshot);
+		if(!target) {
+			HV_LOG_WARNING("Parameter {} is not part of the snapshot", name);
+			return false;
+		}
+	}
+
+	if(valueRef() == *target) {
+		return true;
+	}
+	if(policy == RESET_RUN_CALLBACKS && isWriteLocked()) {
+		return false;
+	}
+	if(policy == RESET_RUN_CALLBACKS && hasCallbacks()) {
+		setValue(*target);
+		return valueRef() == *target;
+	}
+	valueRef() = *target;
+	markDirty();
 	return true;
 }
 
+template<typename T>
+ParamValueIf* ParamBase<T>::copyValue() const {
+	return new ParamValue<T>(valueRef());
+}
+
+template<typename T>
+::cci::cci_value ParamBase<T>::getSnapshotCCIValue(const ConfigSnapshot& snapshot) const {
+	const T* snapshotValue = findSnapshotValue(&snapshot);
+	return snapshotValue ? ::cci::cci_value(*snapshotValue) : ::cci::cci_value();
+}
+
+template<typename T>
+bool ParamBase<T>::isInValueArena() const {
+	return flags & FLAG_ARENA;
+}
+
+template<typename T>
+void ParamBase<T>::detachBroker() {
+	// The value arena lives as long as its broker: take the value back
+	if(flags & FLAG_ARENA) {
+		ParamValueStorage<T>::detach(valueStorage, *_getValueArena(broker));
+		flags &= ~FLAG_ARENA;
+	}
+	broker = nullptr;
+}
+
+template<typename T>
+const T* ParamBase<T>::getPresetValue() const {
+	return nullptr;
+}
+
+template<typename T>
+bool ParamBase<T>::isWriteLocked() const {
+	return false;
+}
+
+template<typename T>
+const T* ParamBase<T>::findSnapshotValue(const ConfigSnapshot* snapshot) const {
+	if(!snapshot) {
+		return nullptr;
+	}
+	if(flags & FLAG_ARENA) {
+		return snapshot->getArenaValue(&valueRef());
+	}
+	const ParamValue<T>* snapshotValue = dynamic_cast<const ParamValue<T>*>(snapshot->getValue(this));
+	return snapshotValue ? &snapshotValue->value : nullptr;
+}
+
 template<typename T>
 bool ParamBase<T>::hasCallbacks() const {
-	return (!preReadCallbacks.isEmpty() ||
-			!postReadCallbacks.isEmpty() ||
-			!preWriteCallbacks.isEmpty() ||
-			!postWriteCallbacks.isEmpty());
+	return cold && (!cold->preReadCallbacks.isEmpty() ||
+			!cold->postReadCallbacks.isEmpty() ||
+			!cold->preWriteCallbacks.isEmpty() ||
+			!cold->postWriteCallbacks.isEmpty());
 }
 
 template<typename T>
 ::hv::common::hvcbID_t ParamBase<T>::registerPreReadCallback(const PreReadCallback<T> &cb) {
 	::hv::common::hvcbID_t idTmp = this->genCallbackID();
-	preReadCallbacks.setCb(idTmp, cb);
+	getColdState().preReadCallbacks.setCb(idTmp, cb);
 	return idTmp;
 }
 
@@ -146,7 +294,7 @@ template<typename U>
 template<typename T>
 ::hv::common::hvcbID_t ParamBase<T>::registerPostReadCallback(const PostReadCallback<T> &cb) {
 	::hv::common::hvcbID_t idTmp = this->genCallbackID();
-	postReadCallbacks.setCb(idTmp, cb);
+	getColdState().postReadCallbacks.setCb(idTmp, cb);
 	return idTmp;
 }
 
@@ -159,7 +307,7 @@ template<typename U>
 template<typename T>
 ::hv::common::hvcbID_t ParamBase<T>::registerPreWriteCallback(const PreWriteCallback<T> &cb) {
 	::hv::common::hvcbID_t idTmp = this->genCallbackID();
-	preWriteCallbacks.setCb(idTmp, cb);
+	getColdState().preWriteCallbacks.setCb(idTmp, cb);
 	return idTmp;
 }
 
@@ -172,7 +320,7 @@ template<typename U>
 template<typename T>
 ::hv::common::hvcbID_t ParamBase<T>::registerPostWriteCallback(const PostWriteCallback<T> &cb) {
 	::hv::common::hvcbID_t idTmp = this->genCallbackID();
-	postWriteCallbacks.setCb(idTmp, cb);
+	getColdState().postWriteCallbacks.setCb(idTmp, cb);
 	return idTmp;
 }
 
@@ -184,8 +332,8 @@ template<typename U>
 
 template<typename T>
 bool ParamBase<T>::unregisterPreReadCallback(const ::hv::common::hvcbID_t &id) {
-	if(preReadCallbacks.hasID(id)) {
-		preReadCallbacks.erase(id);
+	if(cold && cold->preReadCallbacks.hasID(id)) {
+		cold->preReadCallbacks.erase(id);
 		return true;
 	}
 	return false;
@@ -193,8 +341,8 @@ bool ParamBase<T>::unregisterPreReadCallback(const ::hv::common::hvcbID_t &id) {
 
 template<typename T>
 bool ParamBase<T>::unregisterPostReadCallback(const ::hv::common::hvcbID_t &id) {
-	if(postReadCallbacks.hasID(id)) {
-		postReadCallbacks.erase(id);
+	if(cold && cold->postReadCallbacks.hasID(id)) {
+		cold->postReadCallbacks.erase(id);
 		return true;
 	}
 	return false;
@@ -202,8 +350,8 @@ bool ParamBase<T>::unregisterPostReadCallback(const ::hv::common::hvcbID_t &id)
 
 template<typename T>
 bool ParamBase<T>::unregisterPreWriteCallback(const ::hv::common::hvcbID_t &id) {
-	if(preWriteCallbacks.hasID(id)) {
-		preWriteCallbacks.erase(id);
+	if(cold && cold->preWriteCallbacks.hasID(id)) {
+		cold->preWriteCallbacks.erase(id);
 		return true;
 	}
 	return false;
@@ -211,8 +359,8 @@ bool ParamBase<T>::unregisterPreWriteCallback(const ::hv::common::hvcbID_t &id)
 
 template<typename T>
 bool ParamBase<T>::unregisterPostWriteCallback(const ::hv::common::hvcbID_t &id) {
-	if(postWriteCallbacks.hasID(id)) {
-		postWriteCallbacks.erase(id);
+	if(cold && cold->postWriteCallbacks.hasID(id)) {
+		cold->postWriteCallbacks.erase(id);
 		return true;
 	}
 	return false;
@@ -220,94 +368,201 @@ bool ParamBase<T>::unregisterPostWriteCallback(const ::hv::common::hvcbID_t &id)
 
 template<typename T>
 bool ParamBase<T>::unregisterAllCallbacks() {
-	preReadCallbacks.clear();
-	postReadCallbacks.clear();
-	preWriteCallbacks.clear();
-	postWriteCallbacks.clear();
+	if(cold) {
+		cold->preReadCallbacks.clear();
+		cold->postReadCallbacks.clear();
+		cold->preWriteCallbacks.clear();
+		cold->postWriteCallbacks.clear();
+	}
 	return true;
 }
 
 template<typename T>
-void ParamBase<T>::runPreReadCallbacks(const T& value) const
+void ParamBase<T>::runPreReadCallbacks(const T& value, const ::cci::cci_originator* originator) const
 {
 	HV_LOG_TRACE("runPreReadCallbacks");
 
-	if (!preReadCallbacks.isUsing()) {
-		preReadCallbacks.setUsing(true);
-
-		for(auto const &preReadCallback : preReadCallbacks.getMap()) {
-			const ParamReadEvent<T> ev(this->value, *this);
-			(preReadCallback.second)(ev);
+	if (!cold) {
+		return;
+	}
+	const CallbackList<PreReadCallback<T> >& callbacks = cold->preReadCallbacks;
+
+	if (!callbacks.isUsing() && !callbacks.isEmpty()) {
+		callbacks.setUsing(true);
+
+		CCIEventContext context(cciParam, originator);
+		for (std::size_t i = 0; i < callbacks.size(); ++i) {
+			auto entry = callbacks.get(i);
+			if (entry->cci) {
+				const ::cci::cci_param_pre_read_callback_handle<T> callback(entry->cciCallback);
+				if (callback.valid()) {
+					callback.invoke(::cci::cci_param_read_event<T>(this->valueRef(),
+							context.getOriginator(), context.getHandle()));
+				} else {
+					// Untyped callbacks get CCI values, as with cci_param_typed
+					const ::cci::cci_param_pre_read_callback_untyped_handle untypedCallback(entry->cciCallback);
+					if (untypedCallback.valid()) {
+						untypedCallback.invoke(::cci::cci_param_read_event<>(::cci::cci_value(this->valueRef()),
+								context.getOriginator(), context.getHandle()));
+					}
+				}
+			} else {
+				const ParamReadEvent<T> ev(this->valueRef(), *this);
+				(entry->callback)(ev);
+			}
 		}
 
-		preReadCallbacks.setUsing(false);
+		callbacks.setUsing(false);
 	}
 }
 
 template<typename T>
-void ParamBase<T>::runPostReadCallbacks(const T& value) const
+void ParamBase<T>::runPostReadCallbacks(const T& value, const ::cci::cci_originator* originator) const
 {
 	HV_LOG_TRACE("runPostReadCallbacks");
 
-	if (!postReadCallbacks.isUsing()) {
-		postReadCallbacks.setUsing(true);
-
-		for(auto const &postReadCallback : postReadCallbacks.getMap()) {
-			const ParamReadEvent<T> ev(this->value, *this);
-			(postReadCallback.second)(ev);
+	if (!cold) {
+		return;
+	}
+	const CallbackList<PostReadCallback<T> >& callbacks = cold->postReadCallbacks;
+
+	if (!callbacks.isUsing() && !callbacks.isEmpty()) {
+		callbacks.setUsing(true);
+
+		CCIEventContext context(cciParam, originator);
+		for (std::size_t i = 0; i < callbacks.size(); ++i) {
+			auto entry = callbacks.get(i);
+			if (entry->cci) {
+				const ::cci::cci_param_post_read_callback_handle<T> callback(entry->cciCallback);
+				if (callback.valid()) {
+					callback.invoke(::cci::cci_param_read_event<T>(this->valueRef(),
+							context.getOriginator(), context.getHandle()));
+				} else {
+					const ::cci::cci_param_post_read_callback_untyped_handle untypedCallback(entry->cciCallback);
+					if (untypedCallback.valid()) {
+						untypedCallback.invoke(::cci::cci_param_read_event<>(::cci::cci_value(this->valueRef()),
+								context.getOriginator(), context.getHandle()));
+					}
+				}
+			} else {
+				const ParamReadEvent<T> ev(this->valueRef(), *this);
+				(entry->callback)(ev);
+			}
 		}
 
-		postReadCallbacks.setUsing(false);
+		callbacks.setUsing(false);
 	}
 }
 
 template<typename T>
-bool ParamBase<T>::runPreWriteCallbacks(const T& value) const
+bool ParamBase<T>::runPreWriteCallbacks(const T& value, const ::cci::cci_originator* originator) const
 {
 	HV_LOG_TRACE("runPreWriteCallbacks");
 
-	if (!preWriteCallbacks.isUsing()) {
-		preWriteCallbacks.setUsing(true);
+	if (!cold) {
+		return true;
+	}
+	const CallbackList<PreWriteCallback<T> >& callbacks = cold->preWriteCallbacks;
+
+	if (!callbacks.isUsing()) {
+		if (callbacks.isEmpty()) {
+			return true;
+		}
+		callbacks.setUsing(true);
 
 		bool result = true;
-		for(auto const &preWriteCallback : preWriteCallbacks.getMap()) {
-			const ParamWriteEvent<T> ev(this->value, value, *this);
-			if (!(preWriteCallback.second)(ev)) {
+		CCIEventContext context(cciParam, originator);
+		for (std::size_t i = 0; i < callbacks.size(); ++i) {
+			auto entry = callbacks.get(i);
+			bool accepted = true;
+			if (entry->cci) {
+				const ::cci::cci_param_pre_write_callback_handle<T> callback(entry->cciCallback);
+				if (callback.valid()) {
+					accepted = callback.invoke(::cci::cci_param_write_event<T>(this->valueRef(), value,
+							context.getOriginator(), context.getHandle()));
+				} else {
+					const ::cci::cci_param_pre_write_callback_untyped_handle untypedCallback(entry->cciCallback);
+					if (untypedCallback.valid()) {
+						accepted = untypedCallback.invoke(::cci::cci_param_write_event<>(
+								::cci::cci_value(this->valueRef()), ::cci::cci_value(value),
+								context.getOriginator(), context.getHandle()));
+					}
+				}
+			} else {
+				const ParamWriteEvent<T> ev(this->valueRef(), value, *this);
+				accepted = (entry->callback)(ev);
+			}
+			if (!accepted) {
 				HV_LOG_WARNING("The new value has been rejected by a callback.");
 				result = false;
 			}
 		}
 
-		preWriteCallbacks.setUsing(false);
+		callbacks.setUsing(false);
 		return result;
 	}
 	return false;
 }
 
 template<typename T>
-void ParamBase<T>::runPostWriteCallbacks(const T& oldValue, const T& newValue) const
+void ParamBase<T>::runPostWriteCallbacks(const T& oldValue, const T& newValue,
+		const ::cci::cci_originator* originator) const
 {
 	HV_LOG_TRACE("runPostWriteCallbacks");
 
-	if (!postWriteCallbacks.isUsing()) {
-		postWriteCallbacks.setUsing(true);
-
-		for(auto const &postWriteCallback : postWriteCallbacks.getMap()) {
-			const ParamWriteEvent<T> ev(oldValue, newValue, *this);
-			(postWriteCallback.second)(ev);
+	if (!cold) {
+		return;
+	}
+	const CallbackList<PostWriteCallback<T> >& callbacks = cold->postWriteCallbacks;
+
+	if (!callbacks.isUsing() && !callbacks.isEmpty()) {
+		callbacks.setUsing(true);
+
+		CCIEventContext context(cciParam, originator);
+		for (std::size_t i = 0; i < callbacks.size(); ++i) {
+			auto entry = callbacks.get(i);
+			if (entry->cci) {
+				const ::cci::cci_param_post_write_callback_handle<T> callback(entry->cciCallback);
+				if (callback.valid()) {
+					callback.invoke(::cci::cci_param_write_event<T>(oldValue, newValue,
+							context.getOriginator(), context.getHandle()));
+				} else {
+					const ::cci::cci_param_post_write_callback_untyped_handle untypedCallback(entry->cciCallback);
+					if (untypedCallback.valid()) {
+						untypedCallback.invoke(::cci::cci_param_write_event<>(
+								::cci::cci_value(oldValue), ::cci::cci_value(newValue),
+								context.getOriginator(), context.getHandle()));
+					}
+				}
+			} else {
+				const ParamWriteEvent<T> ev(oldValue, newValue, *this);
+				(entry->callback)(ev);
+			}
 		}
 
-		postWriteCallbacks.setUsing(false);
+		callbacks.setUsing(false);
 	}
 }
 
 template<typename T>
 ::hv::common::hvcbID_t ParamBase<T>::genCallbackID() {
-	return cbIDCpt++;
+	return getColdState().cbIDCpt++;
+}
+
+template<typename T>
+typename ParamBase<T>::ColdState& ParamBase<T>::getColdState() {
+	if(!cold) {
+		cold.reset(new ColdState());
+	}
+	return *cold;
 }
 
 template<typename T>
 ParamBase<T>::~ParamBase() {
+	if(broker) {
+		_unregisterParam(broker, this);
+		ParamBase<T>::detachBroker();
+	}
 }
 
 HV_CONFIGURATION_CLOSE_NAMESPACE
@@ -0,0 +1,87 @@
+/*
+ * @file param-cci-data-category.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Compile-time CCI parameter data category
+ */
+
+#ifndef HV_CONFIGURATION_PARAM_CCI_DATA_CATEGORY_H
+#define HV_CONFIGURATION_PARAM_CCI_DATA_CATEGORY_H
+
+#include <array>
+#include <deque>
+#include <list>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include <cci_configuration>
+
+#include "../../configuration/common.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+/**
+ * Data category known at compile time
+ */
+template< ::cci::cci_param_data_category C>
+struct ParamDataCategoryStatic {
+	static constexpr bool isStatic() {
+		return true;
+	}
+
+	static constexpr ::cci::cci_param_data_category category() {
+		return C;
+	}
+};
+
+/**
+ * Parameter data category trait
+ *
+ * Unknown types are inspected at runtime through their CCI value. Specialize
+ * it for user types, e.g.:
+ * template<> struct ParamDataCategoryTrait<CustomStruct> :
+ *         ParamDataCategoryStatic< ::cci::CCI_OTHER_PARAM> {};
+ */
+template<typename T, typename Enable = void>
+struct ParamDataCategoryTrait {
+	static constexpr bool isStatic() {
+		return false;
+	}
+
+	static constexpr ::cci::cci_param_data_category category() {
+		return ::cci::CCI_OTHER_PARAM;
+	}
+};
+
+template<>
+struct ParamDataCategoryTrait<bool> : ParamDataCategoryStatic< ::cci::CCI_BOOL_PARAM> {};
+
+template<typename T>
+struct ParamDataCategoryTrait<T, typename std::enable_if<std::is_integral<T>::value
+		&& !std::is_same<T, bool>::value>::type> : ParamDataCategoryStatic< ::cci::CCI_INTEGRAL_PARAM> {};
+
+template<typename T>
+struct ParamDataCategoryTrait<T, typename std::enable_if<std::is_floating_point<T>::value>::type> :
+		ParamDataCategoryStatic< ::cci::CCI_REAL_PARAM> {};
+
+template<>
+struct ParamDataCategoryTrait<std::string> : ParamDataCategoryStatic< ::cci::CCI_STRING_PARAM> {};
+
+template<typename T, typename A>
+struct ParamDataCategoryTrait<std::vector<T, A> > : ParamDataCategoryStatic< ::cci::CCI_LIST_PARAM> {};
+
+template<typename T, typename A>
+struct ParamDataCategoryTrait<std::list<T, A> > : ParamDataCategoryStatic< ::cci::CCI_LIST_PARAM> {};
+
+template<typename T, typename A>
+struct ParamDataCategoryTrait<std::deque<T, A> > : ParamDataCategoryStatic< ::cci::CCI_LIST_PARAM> {};
+
+template<typename T, std::size_t N>
+struct ParamDataCategoryTrait<std::array<T, N> > : ParamDataCategoryStatic< ::cci::CCI_LIST_PARAM> {};
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_PARAM_CCI_DATA_CATEGORY_H
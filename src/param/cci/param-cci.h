@@ -10,15 +10,25 @@
 #ifndef HV_CONFIGURATION_PARAM_CCI_H
 #define HV_CONFIGURATION_PARAM_CCI_H
 
+#include <memory>
+#include <utility>
+#include <vector>
+
 #include <cci_configuration>
 
 #include "../../configuration/common.h"
+#include "../../configuration/common-cci.h"
+#include "../../configuration/originator-table.h"
+#include "../../configuration/metadata-table.h"
+#include "../../profiler/profiler.h"
+#include "../../checkpoint/checkpoint.h"
+#include "param-cci-data-category.h"
 
 HV_CONFIGURATION_OPEN_NAMESPACE
 
 template<typename T,
         ::cci::cci_param_mutable_type TM = ::cci::CCI_MUTABLE_PARAM>
-class ParamCCI : public ::cci::cci_param_if {
+class ParamCCI : public ::cci::cci_param_if, public PresetListenerIf {
 public:
 	/// @copydoc cci_param_if::get_name
 	const char* name() const override;
@@ -46,6 +56,18 @@ public:
 			const void *password,
 			const ::cci::cci_originator &originator) override;
 
+	/**
+	 * Set the value from a CCI value, reporting failures instead of throwing
+	 *
+	 * @param cciValue CCI value
+	 * @param password Lock password
+	 * @param originator Writer originator
+	 * @return True if the value has been converted and written, otherwise False
+	 */
+	bool try_set_cci_value(const ::cci::cci_value& cciValue,
+			const void* password = nullptr,
+			const ::cci::cci_originator& originator = ::cci::cci_originator());
+
 	/// @copydoc cci_param_if::get_cci_value
 	using cci_param_if::get_cci_value;
 
@@ -82,6 +104,20 @@ public:
 	/// @copydoc cci_param_if::get_metadata
 	::cci::cci_value_map get_metadata() const override;
 
+	/**
+	 * Get parameter metadata without copying them
+	 *
+	 * @return Shared metadata, valid until the next metadata update
+	 */
+	const ::cci::cci_value_map& getMetadata() const;
+
+	/**
+	 * Get the typed preset value
+	 *
+	 * @return Preset value, null if there is none
+	 */
+	const T* getPresetValue() const;
+
 	/// @copydoc cci_param_if::add_metadata
 	void add_metadata(const std::string& name,
 					  const ::cci::cci_value& cciValue,
@@ -145,6 +181,26 @@ public:
 
 	~ParamCCI() override;
 
+	/**
+	 * Save the value origin and the lock state into a checkpoint
+	 *
+	 * @param writer Checkpoint writer
+	 */
+	void saveState(CheckpointWriter& writer) const;
+
+	/**
+	 * Restore the value origin and the lock state from a checkpoint
+	 *
+	 * A locked parameter is restored locked with its default password.
+	 *
+	 * @param reader Checkpoint reader
+	 * @return True if successful, otherwise False
+	 */
+	bool restoreState(CheckpointReader& reader);
+
+	/// @copydoc PresetListenerIf::presetChanged
+	void presetChanged(const ::cci::cci_value& value) override;
+
 private:
 	/// @copydoc cci_param_if::preset_cci_value
 	void preset_cci_value(const ::cci::cci_value&,
@@ -155,6 +211,14 @@ private:
 			const void* password,
 			const ::cci::cci_originator& originator) override;
 
+	bool checkWriteAccess(const void* password, bool report) const;
+
+	/// Get the staging slot, allocated on first use
+	T& getStagingValue();
+
+	/// Move the staging value into the parameter, running write callbacks
+	bool commitStagingValue(const ::cci::cci_originator& originator);
+
 	/// @copydoc cci_param_if::get_raw_value
 	const void* get_raw_value(const ::cci::cci_originator& originator) const override;
 
@@ -174,35 +238,45 @@ private:
 	/// Parameter base
 	ParamBase<T>& paramBase;
 
-	/// Parameter originator
-	const ::cci::cci_originator originator;
+	/// Parameter originator (interned)
+	const OriginatorId originatorId;
+
+	/// Latest writer originator (interned)
+	mutable OriginatorId valueOriginatorId;
+
+	/**
+	 * Rarely used CCI state, allocated on first use
+	 */
+	struct ColdState {
+		ColdState() :
+			paramHandles(), metadata(), lockPassword(nullptr), presetValue(), stagingValue() {
+		}
 
-	/// Parameter handles vector
-	std::vector<::cci::cci_param_untyped_handle*> paramHandles;
+		/// Parameter handles vector
+		std::vector< ::cci::cci_param_untyped_handle*> paramHandles;
 
-	/// Metadata
-	::cci::cci_value_map metadata;
+		/// Shared metadata, null if there is none
+		MetadataPtr metadata;
 
-	/// Lock password
-	const void* lockPassword;
+		/// Lock password
+		const void* lockPassword;
 
-	/// Broker handle
-	::cci::cci_broker_handle brokerHandle;
+		/// Typed preset value, null if there is none
+		std::unique_ptr<T> presetValue;
 
-	/// Latest writer originator
-	mutable ::cci::cci_originator valueOriginator;
+		/// Staging slot for incoming values, reusing the storage of the previous value
+		std::unique_ptr<T> stagingValue;
+	};
 
-	/// Pre write callbacks
-	std::vector<CCICallbackObject<::cci::cci_callback_untyped_handle::type> > preWriteCallbacks;
+	/// Cold state, null until first used
+	std::unique_ptr<ColdState> cold;
 
-	/// Post write callbacks
-	std::vector<CCICallbackObject<::cci::cci_callback_untyped_handle::type> > postWriteCallbacks;
+	/// Get the cold state, allocating it if needed
+	ColdState& getColdState();
 
-	/// Pre read callbacks
-	std::vector<CCICallbackObject<::cci::cci_callback_untyped_handle::type> > preReadCallbacks;
+	/// Get the lock password, null if unlocked
+	const void* getLockPassword() const;
 
-	/// Post read callbacks
-	std::vector<CCICallbackObject<::cci::cci_callback_untyped_handle::type> > postReadCallbacks;
 };
 
 HV_CONFIGURATION_CLOSE_NAMESPACE
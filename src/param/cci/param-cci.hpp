@@ -29,21 +29,37 @@ ParamCCI<T, TM>::ParamCCI(ParamBase<T>& paramBase,
 	    ::cci::cci_broker_handle privateBroker,
 		::cci::cci_name_type nameType,
 		const ::cci::cci_originator& originator):
-		paramBase(paramBase), originator(originator),
-		brokerHandle(privateBroker),
-		valueOriginator(originator) {
+		paramBase(paramBase), originatorId(internOriginator(originator)),
+		valueOriginatorId(originatorId),
+		cold() {
+	paramBase.cciParam = this;
 
 	// Set preset value (if available)
-	if (brokerHandle.has_preset_value(paramBase.getName())) {
-		::cci::cci_value presetCciValue = brokerHandle.get_preset_cci_value(paramBase.getName());
-		T typedValue;
-		if (presetCciValue.try_get<T>(typedValue)) {
-			paramBase.value = typedValue;
-		} else {
-			HV_LOG_ERROR("Unable to load preset CCI value for parameter {}", paramBase.getName());
+	{
+		HV_CFG_PROFILE_SCOPE(PROFILE_PRESET_RESOLUTION);
+		if (privateBroker.has_preset_value(paramBase.getName())) {
+			presetChanged(privateBroker.get_preset_cci_value(paramBase.getName()));
+			if (cold && cold->presetValue) {
+				paramBase.valueRef() = *cold->presetValue;
+				HV_CFG_PROFILE_BYTES(sizeof(T));
+			}
+		}
+	}
+	this->init(privateBroker);
+}
+
+template<typename T,
+        ::cci::cci_param_mutable_type TM>
+void ParamCCI<T, TM>::presetChanged(const ::cci::cci_value& value) {
+	std::unique_ptr<T> typedValue(new T());
+	if (value.try_get<T>(*typedValue)) {
+		getColdState().presetValue = std::move(typedValue);
+	} else {
+		HV_LOG_ERROR("Unable to load preset CCI value for parameter {}", paramBase.getName());
+		if (cold) {
+			cold->presetValue.reset();
 		}
 	}
-	this->init(brokerHandle);
 }
 
 template<typename T,
@@ -53,8 +69,43 @@ ParamCCI<T, TM>::~ParamCCI() {
 	// ::sc_core::sc_assert(paramHandles.empty());
 
 	if(!paramBase.name.empty()) {
-		::cci::cci_unregister_name(name());
+		unregisterName(name());
+	}
+}
+
+template<typename T,
+        ::cci::cci_param_mutable_type TM>
+void ParamCCI<T, TM>::saveState(CheckpointWriter& writer) const {
+	writer.writeString(getOriginator(valueOriginatorId).name());
+	writer.write(static_cast<std::uint8_t>(is_locked()));
+}
+
+template<typename T,
+        ::cci::cci_param_mutable_type TM>
+bool ParamCCI<T, TM>::restoreState(CheckpointReader& reader) {
+	std::string originName;
+	std::uint8_t locked;
+	if(!reader.readString(originName) || !reader.read(locked)) {
+		return false;
+	}
+
+	// Most values come from the parameter owner or keep their origin
+	if(originName != getOriginator(valueOriginatorId).name()) {
+		if(originName == getOriginator(originatorId).name()) {
+			valueOriginatorId = originatorId;
+		} else {
+			valueOriginatorId = internOriginator(::cci::cci_originator(originName));
+		}
+	}
+
+	if(!locked) {
+		if(cold) {
+			cold->lockPassword = nullptr;
+		}
+	} else if(!is_locked()) {
+		getColdState().lockPassword = this;
 	}
+	return true;
 }
 
 template<typename T,
@@ -78,6 +129,9 @@ std::string ParamCCI<T, TM>::get_description() const {
 template<typename T,
         ::cci::cci_param_mutable_type TM>
 ::cci::cci_param_data_category ParamCCI<T, TM>::get_data_category() const {
+	if (ParamDataCategoryTrait<T>::isStatic()) {
+		return ParamDataCategoryTrait<T>::category();
+	}
 	switch (get_cci_value().category()) {
 		case ::cci::CCI_BOOL_VALUE:
 			return ::cci::CCI_BOOL_PARAM;
@@ -99,7 +153,7 @@ template<typename T,
 template<typename T,
 		::cci::cci_param_mutable_type TM>
 const std::type_info& ParamCCI<T, TM>::get_type_info() const {
-	return typeid(paramBase.value);
+	return typeid(T);
 }
 
 template<typename T,
@@ -113,15 +167,24 @@ template<typename T,
 void ParamCCI<T, TM>::set_cci_value(const ::cci::cci_value& cciValue,
 		const void* password,
 		const ::cci::cci_originator& originator) {
-#if !defined(__clang__) && !defined(_MSC_VER)
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
-#endif
-	T typedValue = cciValue.get<T>();
-#if !defined(__clang__) && !defined(_MSC_VER)
-#pragma GCC diagnostic pop
-#endif
-	set_raw_value(&typedValue, password, originator);
+	if (!checkWriteAccess(password, true)) {
+		return;
+	}
+	if (!cciValue.try_get<T>(getStagingValue())) {
+		::cci::cci_report_handler::set_param_failed("Value conversion failed.", __FILE__, __LINE__);
+		return;
+	}
+	commitStagingValue(originator);
+}
+
+template<typename T,
+		::cci::cci_param_mutable_type TM>
+bool ParamCCI<T, TM>::try_set_cci_value(const ::cci::cci_value& cciValue,
+		const void* password,
+		const ::cci::cci_originator& originator) {
+	return checkWriteAccess(password, false)
+			&& cciValue.try_get<T>(getStagingValue())
+			&& commitStagingValue(originator);
 }
 
 template<typename T,
@@ -145,14 +208,7 @@ bool ParamCCI<T, TM>::is_default_value() const {
 template<typename T,
         ::cci::cci_param_mutable_type TM>
 bool ParamCCI<T, TM>::is_preset_value() const {
-	if (brokerHandle.has_preset_value(paramBase.getName())) {
-		::cci::cci_value presetCciValue = brokerHandle.get_preset_cci_value(paramBase.getName());
-		T typedValue;
-		if (presetCciValue.try_get<T>(typedValue)) {
-			return typedValue == paramBase.value;
-		}
-	}
-	return false;
+	return cold && cold->presetValue && *cold->presetValue == paramBase.valueRef();
 }
 
 template<typename T,
@@ -161,10 +217,10 @@ bool ParamCCI<T, TM>::lock(const void* password) {
 	if (!password) {
 		password = this;
 	}
-	if (password != lockPassword && lockPassword != nullptr) {
+	if (password != getLockPassword() && getLockPassword() != nullptr) {
 		return false;
 	} else {
-		lockPassword = password;
+		getColdState().lockPassword = password;
 		return true;
 	}
 }
@@ -172,13 +228,13 @@ bool ParamCCI<T, TM>::lock(const void* password) {
 template<typename T,
         ::cci::cci_param_mutable_type TM>
 ::cci::cci_originator ParamCCI<T, TM>::get_originator() const {
-	return originator;
+	return getOriginator(originatorId);
 }
 
 template<typename T,
         ::cci::cci_param_mutable_type TM>
 ::cci::cci_originator ParamCCI<T, TM>::get_value_origin() const {
-	return valueOriginator;
+	return getOriginator(valueOriginatorId);
 }
 
 template<typename T,
@@ -187,8 +243,8 @@ bool ParamCCI<T, TM>::unlock(const void *password) {
 	if (!password) {
 		password = this;
 	}
-	if (password == lockPassword) {
-		lockPassword = nullptr;
+	if (cold && password == cold->lockPassword) {
+		cold->lockPassword = nullptr;
 		return true;
 	}
 	return false;
@@ -197,13 +253,25 @@ bool ParamCCI<T, TM>::unlock(const void *password) {
 template<typename T,
         ::cci::cci_param_mutable_type TM>
 bool ParamCCI<T, TM>::is_locked() const {
-	return lockPassword != nullptr;
+	return getLockPassword() != nullptr;
 }
 
 template<typename T,
         ::cci::cci_param_mutable_type TM>
 ::cci::cci_value_map ParamCCI<T, TM>::get_metadata() const {
-	return metadata;
+	return getMetadata();
+}
+
+template<typename T,
+        ::cci::cci_param_mutable_type TM>
+const ::cci::cci_value_map& ParamCCI<T, TM>::getMetadata() const {
+	return cold && cold->metadata ? *cold->metadata : getEmptyMetadata();
+}
+
+template<typename T,
+        ::cci::cci_param_mutable_type TM>
+const T* ParamCCI<T, TM>::getPresetValue() const {
+	return cold ? cold->presetValue.get() : nullptr;
 }
 
 template<typename T,
@@ -211,137 +279,195 @@ template<typename T,
 void ParamCCI<T, TM>::add_metadata(const std::string &name,
 				  const ::cci::cci_value& cciValue,
 				  const std::string& description) {
-	metadata.push_entry(name,
+	::cci::cci_value_map updated(getMetadata());
+	updated.push_entry(name,
 			::cci::cci_value_list().push_back(cciValue).push_back(description));
+	getColdState().metadata = internMetadata(updated);
 }
 
 template<typename T,
         ::cci::cci_param_mutable_type TM>
 void ParamCCI<T, TM>::add_param_handle(::cci::cci_param_untyped_handle* paramHandle) {
-	paramHandles.push_back(paramHandle);
+	getColdState().paramHandles.push_back(paramHandle);
 }
 
 template<typename T,
         ::cci::cci_param_mutable_type TM>
 void ParamCCI<T, TM>::remove_param_handle(::cci::cci_param_untyped_handle* paramHandle) {
-	paramHandles.erase(std::remove(paramHandles.begin(),
-			paramHandles.end(),
-			paramHandle),
-					paramHandles.end());
+	if (cold) {
+		std::vector< ::cci::cci_param_untyped_handle*>& paramHandles = cold->paramHandles;
+		paramHandles.erase(std::remove(paramHandles.begin(),
+				paramHandles.end(),
+				paramHandle),
+						paramHandles.end());
+	}
 }
 
 template<typename T,
         ::cci::cci_param_mutable_type TM>
 void ParamCCI<T, TM>::invalidate_all_param_handles() {
-	while(!paramHandles.empty()) {
-		paramHandles.front()->invalidate();
+	while(cold && !cold->paramHandles.empty()) {
+		cold->paramHandles.front()->invalidate();
 	}
 }
 
 template<typename T,
         ::cci::cci_param_mutable_type TM>
 bool ParamCCI<T, TM>::has_callbacks() const {
-	return !preWriteCallbacks.empty()
-	|| !postWriteCallbacks.empty()
-	|| !preReadCallbacks.empty()
-	|| !postReadCallbacks.empty();
+	return paramBase.hasCallbacks();
 }
 
 template<typename T,
         ::cci::cci_param_mutable_type TM>
 bool ParamCCI<T, TM>::unregister_all_callbacks(const ::cci::cci_originator& orig) {
-	if (has_callbacks()) {
-		preWriteCallbacks.clear();
-		postWriteCallbacks.clear();
-		preReadCallbacks.clear();
-		postReadCallbacks.clear();
-		return true;
+	if (!paramBase.cold) {
+		return false;
 	}
-	return false;
+	OriginatorId id;
+	if (!findOriginator(orig, id)) {
+		return false;
+	}
+	bool removed = paramBase.cold->preWriteCallbacks.clearCCI(id);
+	removed = paramBase.cold->postWriteCallbacks.clearCCI(id) || removed;
+	removed = paramBase.cold->preReadCallbacks.clearCCI(id) || removed;
+	removed = paramBase.cold->postReadCallbacks.clearCCI(id) || removed;
+	return removed;
 }
 
 template<typename T,
 		::cci::cci_param_mutable_type TM>
 bool ParamCCI<T, TM>::reset() {
-	paramBase.reset();
-	// FIXME
-	return true;
+	if (is_locked()) {
+		return false;
+	}
+	// Reset to the preset value if there is one, through the write path
+	const T* presetValue = getPresetValue();
+	getStagingValue() = presetValue ? *presetValue : paramBase.defaultValue;
+	return commitStagingValue(get_originator());
 }
 
 template<typename T,
 		::cci::cci_param_mutable_type TM>
 void ParamCCI<T, TM>::preset_cci_value(const ::cci::cci_value& cciValue, const ::cci::cci_originator& originator) {
-	const T& newValue = cciValue.get<T>();
-
-	// TODO: Pre write callback
-
-	// Save old value
-	// T oldValue = paramBase.value; // FIXME
+	if (!cciValue.try_get<T>(getStagingValue())) {
+		::cci::cci_report_handler::set_param_failed("Value conversion failed.", __FILE__, __LINE__);
+		return;
+	}
 
-	// Write new value
+	// Presets bypass callbacks
 #if !defined(__clang__) && !defined(_MSC_VER)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
 #endif
-	paramBase.value = newValue;
+	std::swap(paramBase.valueRef(), *cold->stagingValue);
 #if !defined(__clang__) && !defined(_MSC_VER)
 #pragma GCC diagnostic pop
 #endif
+	paramBase.markDirty();
 
 	// Update value originator
-	valueOriginator = originator;
-
-	// TODO: Post write callback
+	valueOriginatorId = internOriginator(originator);
 }
 
 template<typename T,
 		::cci::cci_param_mutable_type TM>
 void ParamCCI<T, TM>::set_raw_value(const void* value, const void* password,
 				   const ::cci::cci_originator& originator) {
-	const T& newValue = *static_cast<const T*>(value);
+	if (!checkWriteAccess(password, true)) {
+		return;
+	}
+	getStagingValue() = *static_cast<const T*>(value);
+	commitStagingValue(originator);
+}
 
+template<typename T,
+		::cci::cci_param_mutable_type TM>
+bool ParamCCI<T, TM>::checkWriteAccess(const void* password, bool report) const {
 	// FIXME
 	/* if (!paramBase.set_cci_value_allowed(TM)) {
-		return;
+		return false;
 	} */
 
 	if(!password) {
 		if (is_locked()) {
-			::cci::cci_report_handler::set_param_failed("Parameter locked.", __FILE__, __LINE__);
-			return;
+			if (report) {
+				::cci::cci_report_handler::set_param_failed("Parameter locked.", __FILE__, __LINE__);
+			}
+			return false;
 		}
 	} else {
-		if (password != lockPassword) {
-			::cci::cci_report_handler::set_param_failed("Wrong key.", __FILE__, __LINE__);
-			return;
+		if (password != getLockPassword()) {
+			if (report) {
+				::cci::cci_report_handler::set_param_failed("Wrong key.", __FILE__, __LINE__);
+			}
+			return false;
 		}
 	}
+	return true;
+}
 
-	// TODO: Pre write callback
+template<typename T,
+		::cci::cci_param_mutable_type TM>
+typename ParamCCI<T, TM>::ColdState& ParamCCI<T, TM>::getColdState() {
+	if (!cold) {
+		cold.reset(new ColdState());
+	}
+	return *cold;
+}
 
-	// Save old value
-	// T oldValue = paramBase.value; // FIXME
+template<typename T,
+		::cci::cci_param_mutable_type TM>
+const void* ParamCCI<T, TM>::getLockPassword() const {
+	return cold ? cold->lockPassword : nullptr;
+}
+
+template<typename T,
+		::cci::cci_param_mutable_type TM>
+T& ParamCCI<T, TM>::getStagingValue() {
+	ColdState& coldState = getColdState();
+	if (!coldState.stagingValue) {
+		coldState.stagingValue.reset(new T());
+	}
+	return *coldState.stagingValue;
+}
 
-	// Write new value
+template<typename T,
+		::cci::cci_param_mutable_type TM>
+bool ParamCCI<T, TM>::commitStagingValue(const ::cci::cci_originator& originator) {
+	// Callbacks may write the parameter again, reusing the staging slot: the
+	// values of this write are moved out of it meanwhile
+	T value(std::move(*cold->stagingValue));
+	if (!paramBase.runPreWriteCallbacks(value, &originator)) {
+		return false;
+	}
+
+	// The local value now holds the previous value for post write callbacks
 #if !defined(__clang__) && !defined(_MSC_VER)
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
 #endif
-	paramBase.value = newValue;
+	std::swap(paramBase.valueRef(), value);
 #if !defined(__clang__) && !defined(_MSC_VER)
 #pragma GCC diagnostic pop
 #endif
+	paramBase.markDirty();
 
 	// Update value originator
-	valueOriginator = originator;
+	valueOriginatorId = internOriginator(originator);
+
+	paramBase.runPostWriteCallbacks(value, paramBase.valueRef(), &originator);
 
-	// TODO: Post write callback
+	// Give the previous value storage back to the staging slot for the next write
+	std::swap(*cold->stagingValue, value);
+	return true;
 }
 
 template<typename T,
 		::cci::cci_param_mutable_type TM>
 const void* ParamCCI<T, TM>::get_raw_value(const ::cci::cci_originator& originator) const {
-	return &(paramBase.value);
+	paramBase.runPreReadCallbacks(paramBase.valueRef(), &originator);
+	paramBase.runPostReadCallbacks(paramBase.valueRef(), &originator);
+	return &(paramBase.valueRef());
 }
 
 template<typename T,
@@ -354,8 +480,7 @@ template<typename T, ::cci::cci_param_mutable_type TM>
 ::cci::cci_callback_untyped_handle ParamCCI<T, TM>::register_pre_write_callback(
 			const ::cci::cci_callback_untyped_handle& callback,
 			const ::cci::cci_originator& originator) {
-	preWriteCallbacks.push_back(CCICallbackObject<::cci::cci_callback_untyped_handle::type>(callback,
-			originator));
+	paramBase.getColdState().preWriteCallbacks.setCCICb(callback, internOriginator(originator));
 	return callback;
 }
 
@@ -363,21 +488,17 @@ template<typename T, ::cci::cci_param_mutable_type TM>
 bool ParamCCI<T, TM>::unregister_pre_write_callback(
 		const ::cci::cci_callback_untyped_handle& callback,
 		const ::cci::cci_originator& originator) {
-	for (auto it = preWriteCallbacks.begin(); it != preWriteCallbacks.end(); ++it) {
-		if (it->callback == callback && it->originator == originator) {
-			preWriteCallbacks.erase(it);
-			return true;
-		}
-	}
-	return false;
+	// An originator which was never interned has no callback to remove
+	OriginatorId id;
+	return paramBase.cold && findOriginator(originator, id) &&
+			paramBase.cold->preWriteCallbacks.eraseCCI(callback, id);
 }
 
 template<typename T, ::cci::cci_param_mutable_type TM>
 ::cci::cci_callback_untyped_handle ParamCCI<T, TM>::register_post_write_callback(
 		const ::cci::cci_callback_untyped_handle& callback,
 		const ::cci::cci_originator& originator) {
-	postWriteCallbacks.push_back(CCICallbackObject<::cci::cci_callback_untyped_handle::type>(callback,
-			originator));
+	paramBase.getColdState().postWriteCallbacks.setCCICb(callback, internOriginator(originator));
 	return callback;
 }
 
@@ -385,21 +506,16 @@ template<typename T, ::cci::cci_param_mutable_type TM>
 bool ParamCCI<T, TM>::unregister_post_write_callback(
 		const ::cci::cci_callback_untyped_handle& callback,
 		const ::cci::cci_originator& originator) {
-	for (auto it = postWriteCallbacks.begin(); it != postWriteCallbacks.end(); ++it) {
-		if (it->callback == callback && it->originator == originator) {
-			postWriteCallbacks.erase(it);
-			return true;
-		}
-	}
-	return false;
+	OriginatorId id;
+	return paramBase.cold && findOriginator(originator, id) &&
+			paramBase.cold->postWriteCallbacks.eraseCCI(callback, id);
 }
 
 template<typename T, ::cci::cci_param_mutable_type TM>
 ::cci::cci_callback_untyped_handle ParamCCI<T, TM>::register_pre_read_callback(
 		const ::cci::cci_callback_untyped_handle& callback,
 		const ::cci::cci_originator& originator) {
-	preReadCallbacks.push_back(CCICallbackObject<::cci::cci_callback_untyped_handle::type>(callback,
-			originator));
+	paramBase.getColdState().preReadCallbacks.setCCICb(callback, internOriginator(originator));
 	return callback;
 }
 
@@ -407,21 +523,16 @@ template<typename T, ::cci::cci_param_mutable_type TM>
 bool ParamCCI<T, TM>::unregister_pre_read_callback(
 		const ::cci::cci_callback_untyped_handle& callback,
 		const ::cci::cci_originator& originator) {
-	for (auto it = preReadCallbacks.begin(); it != preReadCallbacks.end(); ++it) {
-		if (it->callback == callback && it->originator == originator) {
-			preReadCallbacks.erase(it);
-			return true;
-		}
-	}
-	return false;
+	OriginatorId id;
+	return paramBase.cold && findOriginator(originator, id) &&
+			paramBase.cold->preReadCallbacks.eraseCCI(callback, id);
 }
 
 template<typename T, ::cci::cci_param_mutable_type TM>
 ::cci::cci_callback_untyped_handle ParamCCI<T, TM>::register_post_read_callback(
 		const ::cci::cci_callback_untyped_handle& callback,
 		const ::cci::cci_originator& originator) {
-	postReadCallbacks.push_back(CCICallbackObject<::cci::cci_callback_untyped_handle::type>(callback,
-			originator));
+	paramBase.getColdState().postReadCallbacks.setCCICb(callback, internOriginator(originator));
 	return callback;
 }
 
@@ -429,13 +540,9 @@ template<typename T, ::cci::cci_param_mutable_type TM>
 bool ParamCCI<T, TM>::unregister_post_read_callback(
 		const ::cci::cci_callback_untyped_handle& callback,
 		const ::cci::cci_originator& originator) {
-	for (auto it = postReadCallbacks.begin(); it != postReadCallbacks.end(); ++it) {
-		if (it->callback == callback && it->originator == originator) {
-			postReadCallbacks.erase(it);
-			return true;
-		}
-	}
-	return false;
+	OriginatorId id;
+	return paramBase.cold && findOriginator(originator, id) &&
+			paramBase.cold->postReadCallbacks.eraseCCI(callback, id);
 }
 
 HV_CONFIGURATION_CLOSE_NAMESPACE
@@ -0,0 +1,190 @@
+/*
+ * @file param-array.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Contiguous indexed parameter arrays
+ */
+
+#ifndef HV_CONFIGURATION_PARAM_ARRAY_H
+#define HV_CONFIGURATION_PARAM_ARRAY_H
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "param.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+/**
+ * Parameter holding a contiguous sequence of elements
+ *
+ * The sequence is a single parameter: it is named, registered and exposed to
+ * CCI once, as a list value, and YAML sequences are accepted as presets.
+ * Element writes go straight to the storage when no callback is registered;
+ * otherwise, they are applied to a copy committed through the regular
+ * write path so callbacks observe whole values.
+ */
+template<typename C, ::cci::cci_param_mutable_type TM = ::cci::CCI_MUTABLE_PARAM>
+class ParamSequence : public Param<C, TM> {
+public:
+	typedef typename C::value_type ElementType;
+
+	ParamSequence(const std::string& name,
+			const C& defaultValue,
+			const std::string& description = "",
+			::cci::cci_name_type nameType = ::cci::CCI_RELATIVE_NAME,
+			const ::cci::cci_originator& originator = ::cci::cci_originator());
+
+	ParamSequence(const std::string& name,
+			const C& defaultValue,
+			::cci::cci_broker_handle privateBroker,
+			const std::string& description = "",
+			::cci::cci_name_type nameType = ::cci::CCI_RELATIVE_NAME,
+			const ::cci::cci_originator& originator = ::cci::cci_originator());
+
+	using ParamBase<C>::operator=;
+
+	/**
+	 * Get the number of elements
+	 *
+	 * @return Number of elements
+	 */
+	std::size_t size() const;
+
+	/**
+	 * Get an element (unchecked)
+	 *
+	 * @param index Element index
+	 * @return Element
+	 */
+	const ElementType& operator[](std::size_t index) const;
+
+	/**
+	 * Get the elements
+	 *
+	 * @return Pointer to the first element
+	 */
+	const ElementType* data() const;
+
+	/**
+	 * Set an element
+	 *
+	 * @param index Element index
+	 * @param value Element value
+	 * @return True if the index is valid, otherwise False
+	 */
+	bool set(std::size_t index, const ElementType& value);
+
+	/**
+	 * Set a range of elements
+	 *
+	 * @param values Element values
+	 * @param count Number of elements
+	 * @param offset Index of the first element to set
+	 * @return True if the range is valid, otherwise False
+	 */
+	bool assign(const ElementType* values, std::size_t count, std::size_t offset = 0);
+
+	/**
+	 * Set all elements
+	 *
+	 * @param value Element value
+	 */
+	void fill(const ElementType& value);
+};
+
+/**
+ * Fixed size parameter array, e.g. a register file
+ */
+template<typename T, std::size_t N, ::cci::cci_param_mutable_type TM = ::cci::CCI_MUTABLE_PARAM>
+class ParamArray : public ParamSequence<std::array<T, N>, TM> {
+public:
+	ParamArray(const std::string& name,
+			const std::array<T, N>& defaultValue,
+			const std::string& description = "",
+			::cci::cci_name_type nameType = ::cci::CCI_RELATIVE_NAME,
+			const ::cci::cci_originator& originator = ::cci::cci_originator());
+
+	/// Construct an array whose elements default to the same value
+	ParamArray(const std::string& name,
+			const T& defaultElement,
+			const std::string& description = "",
+			::cci::cci_name_type nameType = ::cci::CCI_RELATIVE_NAME,
+			const ::cci::cci_originator& originator = ::cci::cci_originator());
+
+	using ParamBase<std::array<T, N> >::operator=;
+
+private:
+	static std::array<T, N> makeFilled(const T& value);
+};
+
+/**
+ * Runtime sized parameter array
+ *
+ * The size is the default value size; presets and writes may change it.
+ */
+template<typename T, ::cci::cci_param_mutable_type TM = ::cci::CCI_MUTABLE_PARAM>
+class ParamVector : public ParamSequence<std::vector<T>, TM> {
+public:
+	ParamVector(const std::string& name,
+			const std::vector<T>& defaultValue,
+			const std::string& description = "",
+			::cci::cci_name_type nameType = ::cci::CCI_RELATIVE_NAME,
+			const ::cci::cci_originator& originator = ::cci::cci_originator());
+
+	/// Construct a vector of size elements defaulting to the same value
+	ParamVector(const std::string& name,
+			std::size_t size,
+			const T& defaultElement,
+			const std::string& description = "",
+			::cci::cci_name_type nameType = ::cci::CCI_RELATIVE_NAME,
+			const ::cci::cci_originator& originator = ::cci::cci_originator());
+
+	using ParamBase<std::vector<T> >::operator=;
+};
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+namespace cci {
+
+/**
+ * CCI value converter of fixed size arrays, as lists of exactly N elements
+ */
+template<typename T, std::size_t N>
+struct cci_value_converter<std::array<T, N> > {
+	typedef std::array<T, N> type;
+
+	static bool pack(cci_value::reference dst, const type& src) {
+		cci_value_list_ref list = dst.set_list();
+		list.reserve(N);
+		for(std::size_t i = 0; i < N; ++i) {
+			list.push_back(src[i]);
+		}
+		return true;
+	}
+
+	static bool unpack(type& dst, cci_value::const_reference src) {
+		if(!src.is_list()) {
+			return false;
+		}
+		cci_value::const_list_reference list = src.get_list();
+		if(list.size() != N) {
+			return false;
+		}
+		for(std::size_t i = 0; i < N; ++i) {
+			if(!list[i].try_get(dst[i])) {
+				return false;
+			}
+		}
+		return true;
+	}
+};
+
+}
+
+#include "param-array.hpp"
+
+#endif // HV_CONFIGURATION_PARAM_ARRAY_H
@@ -0,0 +1,149 @@
+/*
+ * @file param-array.hpp
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Contiguous indexed parameter arrays implementation
+ */
+
+#ifndef HV_CONFIGURATION_PARAM_ARRAY_IMPL_H
+#define HV_CONFIGURATION_PARAM_ARRAY_IMPL_H
+
+#include <algorithm>
+
+#include "param-array.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+template<typename C, ::cci::cci_param_mutable_type TM>
+ParamSequence<C, TM>::ParamSequence(const std::string& name,
+		const C& defaultValue,
+		const std::string& description,
+		::cci::cci_name_type nameType,
+		const ::cci::cci_originator& originator) :
+		ParamBase<C>(name, defaultValue, description),
+		Param<C, TM>(name, defaultValue, description, nameType, originator) {
+}
+
+template<typename C, ::cci::cci_param_mutable_type TM>
+ParamSequence<C, TM>::ParamSequence(const std::string& name,
+		const C& defaultValue,
+		::cci::cci_broker_handle privateBroker,
+		const std::string& description,
+		::cci::cci_name_type nameType,
+		const ::cci::cci_originator& originator) :
+		ParamBase<C>(name, defaultValue, description),
+		Param<C, TM>(name, defaultValue, privateBroker, description, nameType, originator) {
+}
+
+template<typename C, ::cci::cci_param_mutable_type TM>
+std::size_t ParamSequence<C, TM>::size() const {
+	return this->valueRef().size();
+}
+
+template<typename C, ::cci::cci_param_mutable_type TM>
+const typename ParamSequence<C, TM>::ElementType& ParamSequence<C, TM>::operator[](std::size_t index) const {
+	return this->hasCallbacks() ? this->getValue()[index] : this->valueRef()[index];
+}
+
+template<typename C, ::cci::cci_param_mutable_type TM>
+const typename ParamSequence<C, TM>::ElementType* ParamSequence<C, TM>::data() const {
+	return this->hasCallbacks() ? this->getValue().data() : this->valueRef().data();
+}
+
+template<typename C, ::cci::cci_param_mutable_type TM>
+bool ParamSequence<C, TM>::set(std::size_t index, const ElementType& value) {
+	if(index >= this->valueRef().size()) {
+		HV_LOG_ERROR("Index {} out of range for parameter {}", index, this->getName());
+		return false;
+	}
+	if(this->hasCallbacks()) {
+		C newValue(this->valueRef());
+		newValue[index] = value;
+		this->setValue(newValue);
+	} else {
+		this->valueRef()[index] = value;
+		this->markDirty();
+	}
+	return true;
+}
+
+template<typename C, ::cci::cci_param_mutable_type TM>
+bool ParamSequence<C, TM>::assign(const ElementType* values, std::size_t count, std::size_t offset) {
+	if(offset > this->valueRef().size() || count > this->valueRef().size() - offset) {
+		HV_LOG_ERROR("Range [{}, {}) out of range for parameter {}", offset, offset + count, this->getName());
+		return false;
+	}
+	if(this->hasCallbacks()) {
+		C newValue(this->valueRef());
+		std::copy(values, values + count, newValue.begin() + offset);
+		this->setValue(newValue);
+	} else {
+		std::copy(values, values + count, this->valueRef().begin() + offset);
+		this->markDirty();
+	}
+	return true;
+}
+
+template<typename C, ::cci::cci_param_mutable_type TM>
+void ParamSequence<C, TM>::fill(const ElementType& value) {
+	if(this->hasCallbacks()) {
+		C newValue(this->valueRef());
+		std::fill(newValue.begin(), newValue.end(), value);
+		this->setValue(newValue);
+	} else {
+		std::fill(this->valueRef().begin(), this->valueRef().end(), value);
+		this->markDirty();
+	}
+}
+
+template<typename T, std::size_t N, ::cci::cci_param_mutable_type TM>
+ParamArray<T, N, TM>::ParamArray(const std::string& name,
+		const std::array<T, N>& defaultValue,
+		const std::string& description,
+		::cci::cci_name_type nameType,
+		const ::cci::cci_originator& originator) :
+		ParamBase<std::array<T, N> >(name, defaultValue, description),
+		ParamSequence<std::array<T, N>, TM>(name, defaultValue, description, nameType, originator) {
+}
+
+template<typename T, std::size_t N, ::cci::cci_param_mutable_type TM>
+ParamArray<T, N, TM>::ParamArray(const std::string& name,
+		const T& defaultElement,
+		const std::string& description,
+		::cci::cci_name_type nameType,
+		const ::cci::cci_originator& originator) :
+		ParamArray(name, makeFilled(defaultElement), description, nameType, originator) {
+}
+
+template<typename T, std::size_t N, ::cci::cci_param_mutable_type TM>
+std::array<T, N> ParamArray<T, N, TM>::makeFilled(const T& value) {
+	std::array<T, N> array;
+	array.fill(value);
+	return array;
+}
+
+template<typename T, ::cci::cci_param_mutable_type TM>
+ParamVector<T, TM>::ParamVector(const std::string& name,
+		const std::vector<T>& defaultValue,
+		const std::string& description,
+		::cci::cci_name_type nameType,
+		const ::cci::cci_originator& originator) :
+		ParamBase<std::vector<T> >(name, defaultValue, description),
+		ParamSequence<std::vector<T>, TM>(name, defaultValue, description, nameType, originator) {
+}
+
+template<typename T, ::cci::cci_param_mutable_type TM>
+ParamVector<T, TM>::ParamVector(const std::string& name,
+		std::size_t size,
+		const T& defaultElement,
+		const std::string& description,
+		::cci::cci_name_type nameType,
+		const ::cci::cci_originator& originator) :
+		ParamVector(name, std::vector<T>(size, defaultElement), description, nameType, originator) {
+}
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_PARAM_ARRAY_IMPL_H
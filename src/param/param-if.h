@@ -19,15 +19,140 @@ HV_CONFIGURATION_OPEN_NAMESPACE
 template <typename T>
 class ParamBase;
 
+class CheckpointWriter;
+class CheckpointReader;
+class ConfigSnapshot;
+class Exporter;
+class ParamValueIf;
+
 enum NameType {
 	RELATIVE_NAME,
 	ABSOLUTE_NAME
 };
 
+/// Value a parameter is reset to
+enum ResetMode {
+	/// Default value
+	RESET_DEFAULT,
+	/// Preset value, default value if there is none
+	RESET_PRESET,
+	/// Value in a configuration snapshot
+	RESET_SNAPSHOT
+};
+
+/// Callback handling during a reset
+enum ResetPolicy {
+	/// Modified values go through the write path: callbacks run and may reject them, locks apply
+	RESET_RUN_CALLBACKS,
+	/// Values are written back directly, as with a checkpoint restore
+	RESET_SKIP_CALLBACKS
+};
+
 class ParamIf {
 public:
 	virtual const std::string& getName() const = 0;
 
+	/**
+	 * Save the parameter state (value, value origin, lock) into a checkpoint
+	 *
+	 * @param writer Checkpoint writer
+	 */
+	virtual void saveState(CheckpointWriter& writer) const = 0;
+
+	/**
+	 * Restore the parameter state from a checkpoint, without running callbacks
+	 *
+	 * @param reader Checkpoint reader
+	 * @return True if successful, otherwise False
+	 */
+	virtual bool restoreState(CheckpointReader& reader) = 0;
+
+	/**
+	 * Indicates whether the value changed since the last checkpoint
+	 *
+	 * @return True if the value changed, otherwise False
+	 */
+	virtual bool isDirty() const = 0;
+
+	/**
+	 * Flag the value as changed since the last checkpoint
+	 */
+	virtual void markDirty() = 0;
+
+	/**
+	 * Clear the dirty flag once the value has been checkpointed
+	 */
+	virtual void clearDirty() = 0;
+
+	/**
+	 * Get the position of the parameter in the broker dirty list
+	 *
+	 * @return Position set by setDirtyIndex()
+	 */
+	virtual std::size_t getDirtyIndex() const = 0;
+
+	/**
+	 * Set the position of the parameter in the broker dirty list
+	 *
+	 * @param index Position
+	 */
+	virtual void setDirtyIndex(std::size_t index) = 0;
+
+	/**
+	 * Indicates whether the current value is the one provided during construction
+	 *
+	 * @return True if it is the default value, otherwise False
+	 */
+	virtual bool isDefaultValue() const = 0;
+
+	/**
+	 * Reset the parameter value
+	 *
+	 * Values already equal to their target are left untouched.
+	 *
+	 * @param mode Value to reset to
+	 * @param policy Callback handling
+	 * @param snapshot Snapshot, for RESET_SNAPSHOT
+	 * @return True if the value is the target, otherwise False
+	 */
+	virtual bool resetValue(ResetMode mode, ResetPolicy policy, const ConfigSnapshot* snapshot) = 0;
+
+	/**
+	 * Copy the parameter value
+	 *
+	 * @return Value copy, owned by the caller
+	 */
+	virtual ParamValueIf* copyValue() const = 0;
+
+	/**
+	 * Get the value of the parameter in a snapshot
+	 *
+	 * @param snapshot Snapshot
+	 * @return CCI value, null if the parameter is not part of the snapshot
+	 */
+	virtual ::cci::cci_value getSnapshotCCIValue(const ConfigSnapshot& snapshot) const = 0;
+
+	/**
+	 * Indicates whether the value is stored in the broker value arena
+	 *
+	 * @return True if the value is in the arena, otherwise False
+	 */
+	virtual bool isInValueArena() const = 0;
+
+	/**
+	 * Forget the broker the parameter is registered into, on broker destruction
+	 *
+	 * A value stored in the broker value arena is moved back into the parameter.
+	 */
+	virtual void detachBroker() = 0;
+
+	/**
+	 * Export the parameter value (and metadata if requested)
+	 *
+	 * @param exporter Exporter
+	 */
+	virtual void exportParam(Exporter& exporter) const = 0;
+
 	template<typename T>
 	ParamBase<T>* getParamTyped() const {
 		return static_cast< ParamBase<T>* >(this);
@@ -0,0 +1,207 @@
+/*
+ * @file param-struct.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Generated converters for struct parameters
+ */
+
+#ifndef HV_CONFIGURATION_PARAM_STRUCT_H
+#define HV_CONFIGURATION_PARAM_STRUCT_H
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include <cci_configuration>
+
+#include "../configuration/common.h"
+#include "../checkpoint/param-serializer.h"
+#include "cci/param-cci-data-category.h"
+
+/// Maximum number of fields of a struct declared with HV_CFG_STRUCT
+#define HV_CFG_STRUCT_MAX_FIELDS 16
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+/**
+ * FNV-1a hash of a null-terminated field name, usable as a case label
+ *
+ * @param str Field name
+ * @param hash Current hash
+ * @return Hash
+ */
+constexpr std::uint32_t paramStructHash(const char* str, std::uint32_t hash = 2166136261u) {
+	return *str ? paramStructHash(str + 1, (hash ^ static_cast<std::uint8_t>(*str)) * 16777619u) : hash;
+}
+
+/**
+ * FNV-1a hash of a map key
+ *
+ * @param str Key
+ * @param size Key size
+ * @return Hash
+ */
+inline std::uint32_t paramStructHash(const char* str, std::size_t size) {
+	std::uint32_t hash = 2166136261u;
+	for(std::size_t i = 0; i < size; ++i) {
+		hash = (hash ^ static_cast<std::uint8_t>(str[i])) * 16777619u;
+	}
+	return hash;
+}
+
+/**
+ * Struct parameter field table, specialized by HV_CFG_STRUCT
+ */
+template<typename T>
+struct ParamStructTraits {
+	static constexpr bool isStruct = false;
+};
+
+/**
+ * CCI value converter of a struct declared with HV_CFG_STRUCT
+ *
+ * Structs are CCI maps with one entry per field. Unpacking is a single pass
+ * over the map: each key is dispatched to its field by a switch on its hash,
+ * which the compiler rejects if two field names collide. Every field must be
+ * present; unknown keys are ignored.
+ */
+template<typename T>
+struct ParamStructConverter {
+	typedef T type;
+
+	static bool pack(::cci::cci_value::reference dst, const type& src) {
+		ParamStructTraits<T>::pack(dst.set_map(), src);
+		return true;
+	}
+
+	static bool unpack(type& dst, ::cci::cci_value::const_reference src) {
+		if(!src.is_map()) {
+			return false;
+		}
+		::cci::cci_value::const_map_reference map = src.get_map();
+		std::uint32_t found = 0;
+		for(auto it = map.begin(); it != map.end(); ++it) {
+			bool converted = false;
+			const int index = ParamStructTraits<T>::unpackField(it->key.c_str(), it->key.size(),
+					it->value, dst, converted);
+			if(index >= 0) {
+				if(!converted) {
+					return false;
+				}
+				found |= std::uint32_t(1) << index;
+			}
+		}
+		return found == (std::uint32_t(1) << ParamStructTraits<T>::fieldCount) - 1;
+	}
+};
+
+/**
+ * Struct values are checkpointed field by field
+ */
+template<typename T>
+struct ParamSerializer<T, typename std::enable_if<ParamStructTraits<T>::isStruct>::type> {
+	static void save(CheckpointWriter& writer, const T& value) {
+		ParamStructTraits<T>::save(writer, value);
+	}
+
+	static bool restore(CheckpointReader& reader, T& value) {
+		return ParamStructTraits<T>::restore(reader, value);
+	}
+};
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#define HV_CFG_STRUCT_EXPAND(x) x
+#define HV_CFG_STRUCT_CONCAT(a, b) HV_CFG_STRUCT_CONCAT_(a, b)
+#define HV_CFG_STRUCT_CONCAT_(a, b) a##b
+
+#define HV_CFG_STRUCT_COUNT(...) HV_CFG_STRUCT_EXPAND(HV_CFG_STRUCT_COUNT_N(__VA_ARGS__, \
+		16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1))
+#define HV_CFG_STRUCT_COUNT_N(_1, _2, _3, _4, _5, _6, _7, _8, _9, _10, _11, _12, _13, _14, _15, _16, \
+		N, ...) N
+
+// Apply M(type, index, field) to each field in declaration order, indexes counting up from 0
+#define HV_CFG_STRUCT_FOR_EACH(M, T, ...) HV_CFG_STRUCT_EXPAND(HV_CFG_STRUCT_CONCAT( \
+		HV_CFG_STRUCT_FOR_EACH_, HV_CFG_STRUCT_COUNT(__VA_ARGS__))(M, T, HV_CFG_STRUCT_COUNT(__VA_ARGS__), __VA_ARGS__))
+#define HV_CFG_STRUCT_FOR_EACH_1(M, T, n, f) M(T, (n - 1), f)
+#define HV_CFG_STRUCT_FOR_EACH_2(M, T, n, f, ...) M(T, (n - 2), f) HV_CFG_STRUCT_EXPAND(HV_CFG_STRUCT_FOR_EACH_1(M, T, n, __VA_ARGS__))
+#define HV_CFG_STRUCT_FOR_EACH_3(M, T, n, f, ...) M(T, (n - 3), f) HV_CFG_STRUCT_EXPAND(HV_CFG_STRUCT_FOR_EACH_2(M, T, n, __VA_ARGS__))
+#define HV_CFG_STRUCT_FOR_EACH_4(M, T, n, f, ...) M(T, (n - 4), f) HV_CFG_STRUCT_EXPAND(HV_CFG_STRUCT_FOR_EACH_3(M, T, n, __VA_ARGS__))
+#define HV_CFG_STRUCT_FOR_EACH_5(M, T, n, f, ...) M(T, (n - 5), f) HV_CFG_STRUCT_EXPAND(HV_CFG_STRUCT_FOR_EACH_4(M, T, n, __VA_ARGS__))
+#define HV_CFG_STRUCT_FOR_EACH_6(M, T, n, f, ...) M(T, (n - 6), f) HV_CFG_STRUCT_EXPAND(HV_CFG_STRUCT_FOR_EACH_5(M, T, n, __VA_ARGS__))
+#define HV_CFG_STRUCT_FOR_EACH_7(M, T, n, f, ...) M(T, (n - 7), f) HV_CFG_STRUCT_EXPAND(HV_CFG_STRUCT_FOR_EACH_6(M, T, n, __VA_ARGS__))
+#define HV_CFG_STRUCT_FOR_EACH_8(M, T, n, f, ...) M(T, (n - 8), f) HV_CFG_STRUCT_EXPAND(HV_CFG_STRUCT_FOR_EACH_7(M, T, n, __VA_ARGS__))
+#define HV_CFG_STRUCT_FOR_EACH_9(M, T, n, f, ...) M(T, (n - 9), f) HV_CFG_STRUCT_EXPAND(HV_CFG_STRUCT_FOR_EACH_8(M, T, n, __VA_ARGS__))
+#define HV_CFG_STRUCT_FOR_EACH_10(M, T, n, f, ...) M(T, (n - 10), f) HV_CFG_STRUCT_EXPAND(HV_CFG_STRUCT_FOR_EACH_9(M, T, n, __VA_ARGS__))
+#define HV_CFG_STRUCT_FOR_EACH_11(M, T, n, f, ...) M(T, (n - 11), f) HV_CFG_STRUCT_EXPAND(HV_CFG_STRUCT_FOR_EACH_10(M, T, n, __VA_ARGS__))
+#define HV_CFG_STRUCT_FOR_EACH_12(M, T, n, f, ...) M(T, (n - 12), f) HV_CFG_STRUCT_EXPAND(HV_CFG_STRUCT_FOR_EACH_11(M, T, n, __VA_ARGS__))
+#define HV_CFG_STRUCT_FOR_EACH_13(M, T, n, f, ...) M(T, (n - 13), f) HV_CFG_STRUCT_EXPAND(HV_CFG_STRUCT_FOR_EACH_12(M, T, n, __VA_ARGS__))
+#define HV_CFG_STRUCT_FOR_EACH_14(M, T, n, f, ...) M(T, (n - 14), f) HV_CFG_STRUCT_EXPAND(HV_CFG_STRUCT_FOR_EACH_13(M, T, n, __VA_ARGS__))
+#define HV_CFG_STRUCT_FOR_EACH_15(M, T, n, f, ...) M(T, (n - 15), f) HV_CFG_STRUCT_EXPAND(HV_CFG_STRUCT_FOR_EACH_14(M, T, n, __VA_ARGS__))
+#define HV_CFG_STRUCT_FOR_EACH_16(M, T, n, f, ...) M(T, (n - 16), f) HV_CFG_STRUCT_EXPAND(HV_CFG_STRUCT_FOR_EACH_15(M, T, n, __VA_ARGS__))
+
+#define HV_CFG_STRUCT_PACK(T, index, field) \
+	dst.push_entry(#field, src.field);
+
+#define HV_CFG_STRUCT_UNPACK(T, index, field) \
+	case ::hv::cfg::paramStructHash(#field): \
+		if(size == sizeof(#field) - 1 && std::memcmp(key, #field, size) == 0) { \
+			converted = value.try_get(dst.field); \
+			return index; \
+		} \
+		break;
+
+#define HV_CFG_STRUCT_SAVE(T, index, field) \
+	::hv::cfg::ParamSerializer<decltype(src.field)>::save(writer, src.field);
+
+#define HV_CFG_STRUCT_RESTORE(T, index, field) \
+	&& ::hv::cfg::ParamSerializer<decltype(dst.field)>::restore(reader, dst.field)
+
+/**
+ * Declare a struct parameter type from its fields
+ *
+ * Generates the CCI value converter (a map with one entry per field), the
+ * field table used to unpack it, its data category and its checkpoint
+ * encoding. Use it at global scope, after the struct definition and before
+ * any parameter of this type, e.g.:
+ * HV_CFG_STRUCT(CustomStruct, message, size)
+ *
+ * The type must be named without template arguments (use a typedef) and
+ * have at most HV_CFG_STRUCT_MAX_FIELDS fields.
+ */
+#define HV_CFG_STRUCT(T, ...) \
+	HV_CONFIGURATION_OPEN_NAMESPACE \
+	template<> \
+	struct ParamStructTraits<T> { \
+		static constexpr bool isStruct = true; \
+		static constexpr std::size_t fieldCount = HV_CFG_STRUCT_COUNT(__VA_ARGS__); \
+		static void pack(::cci::cci_value_map_ref dst, const T& src) { \
+			HV_CFG_STRUCT_FOR_EACH(HV_CFG_STRUCT_PACK, T, __VA_ARGS__) \
+		} \
+		static int unpackField(const char* key, std::size_t size, \
+				::cci::cci_value::const_reference value, T& dst, bool& converted) { \
+			switch(::hv::cfg::paramStructHash(key, size)) { \
+			HV_CFG_STRUCT_FOR_EACH(HV_CFG_STRUCT_UNPACK, T, __VA_ARGS__) \
+			default: \
+				break; \
+			} \
+			return -1; \
+		} \
+		static void save(CheckpointWriter& writer, const T& src) { \
+			HV_CFG_STRUCT_FOR_EACH(HV_CFG_STRUCT_SAVE, T, __VA_ARGS__) \
+		} \
+		static bool restore(CheckpointReader& reader, T& dst) { \
+			return true HV_CFG_STRUCT_FOR_EACH(HV_CFG_STRUCT_RESTORE, T, __VA_ARGS__); \
+		} \
+	}; \
+	template<> \
+	struct ParamDataCategoryTrait<T> : ParamDataCategoryStatic< ::cci::CCI_OTHER_PARAM> {}; \
+	HV_CONFIGURATION_CLOSE_NAMESPACE \
+	namespace cci { \
+	template<> \
+	struct cci_value_converter<T> : ::hv::cfg::ParamStructConverter<T> {}; \
+	}
+
+#endif // HV_CONFIGURATION_PARAM_STRUCT_H
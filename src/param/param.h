@@ -52,6 +52,22 @@ public:
 
 	~Param();
 
+	/// @copydoc ParamIf::saveState
+	void saveState(CheckpointWriter& writer) const override;
+
+	/// @copydoc ParamIf::restoreState
+	bool restoreState(CheckpointReader& reader) override;
+
+	/// @copydoc ParamIf::exportParam
+	void exportParam(Exporter& exporter) const override;
+
+protected:
+	/// @copydoc ParamBase::getPresetValue
+	const T* getPresetValue() const override;
+
+	/// @copydoc ParamBase::isWriteLocked
+	bool isWriteLocked() const override;
+
 protected:
 	/// Parameter initialization
 	// void init();
@@ -79,6 +79,33 @@ template<typename T, ::cci::cci_param_mutable_type TM>
 Param<T, TM>::~Param() {
 }
 
+template<typename T, ::cci::cci_param_mutable_type TM>
+void Param<T, TM>::saveState(CheckpointWriter& writer) const {
+	paramCCI.saveState(writer);
+	ParamBase<T>::saveState(writer);
+}
+
+template<typename T, ::cci::cci_param_mutable_type TM>
+bool Param<T, TM>::restoreState(CheckpointReader& reader) {
+	return paramCCI.restoreState(reader) && ParamBase<T>::restoreState(reader);
+}
+
+template<typename T, ::cci::cci_param_mutable_type TM>
+void Param<T, TM>::exportParam(Exporter& exporter) const {
+	ParamBase<T>::exportParam(exporter);
+	exporter.writeMetadata(paramCCI.getMetadata());
+}
+
+template<typename T, ::cci::cci_param_mutable_type TM>
+bool Param<T, TM>::isWriteLocked() const {
+	return paramCCI.is_locked();
+}
+
+template<typename T, ::cci::cci_param_mutable_type TM>
+const T* Param<T, TM>::getPresetValue() const {
+	return paramCCI.getPresetValue();
+}
+
 HV_CONFIGURATION_CLOSE_NAMESPACE
 
 #endif // HV_CONFIGURATION_PARAM_IMPL_H
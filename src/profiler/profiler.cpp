@@ -0,0 +1,168 @@
+/*
+ * @file profiler.cpp
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Elaboration profiling of the configuration layer
+ */
+
+#include "profiler.h"
+
+#include <cstdlib>
+#include <fstream>
+#include <sstream>
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+namespace {
+
+const char* const phaseNames[PROFILE_PHASE_COUNT] = {
+	"yaml_load",
+	"name_generation",
+	"preset_resolution",
+	"param_registration",
+	"cci_registration"
+};
+
+/// Index of the most significant bit of a non-null value
+unsigned int getMostSignificantBit(std::uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+	return 63 - static_cast<unsigned int>(__builtin_clzll(value));
+#else
+	unsigned int msb = 0;
+	while(value >>= 1) {
+		msb++;
+	}
+	return msb;
+#endif
+}
+
+std::size_t getBucket(std::uint64_t value) {
+	if(value < HV_CONFIGURATION_PROFILE_SUB_BUCKETS) {
+		return static_cast<std::size_t>(value);
+	}
+	// 3 bits of mantissa below the most significant bit
+	const unsigned int msb = getMostSignificantBit(value);
+	const std::uint64_t sub = (value >> (msb - 3)) & (HV_CONFIGURATION_PROFILE_SUB_BUCKETS - 1);
+	return (msb - 2) * HV_CONFIGURATION_PROFILE_SUB_BUCKETS + static_cast<std::size_t>(sub);
+}
+
+std::uint64_t getBucketValue(std::size_t bucket) {
+	if(bucket < HV_CONFIGURATION_PROFILE_SUB_BUCKETS) {
+		return bucket;
+	}
+	const std::size_t msb = bucket / HV_CONFIGURATION_PROFILE_SUB_BUCKETS + 2;
+	const std::uint64_t sub = bucket % HV_CONFIGURATION_PROFILE_SUB_BUCKETS;
+	return (HV_CONFIGURATION_PROFILE_SUB_BUCKETS + sub) << (msb - 3);
+}
+
+}
+
+Profiler& Profiler::get() {
+	static Profiler profiler;
+	return profiler;
+}
+
+Profiler::Profiler() : enabled(false), stageCallbackRegistered(false), reportPath() {
+	reset();
+	const char* env = std::getenv(HV_CONFIGURATION_PROFILE_ENV);
+	if(env && *env && std::string(env) != "0") {
+		setReportPath(std::string(env) == "1" ? HV_CONFIGURATION_PROFILE_DEFAULT_PATH : env);
+		setEnabled(true);
+	}
+}
+
+void Profiler::setEnabled(bool enabled) {
+	this->enabled = enabled;
+	if(enabled && !stageCallbackRegistered.exchange(true)) {
+		sc_core::sc_register_stage_callback(*this, sc_core::SC_POST_END_OF_ELABORATION);
+	}
+}
+
+void Profiler::setReportPath(const std::string& path) {
+	reportPath = path;
+}
+
+void Profiler::record(ProfilePhase phase, std::uint64_t duration, std::size_t bytes) {
+	PhaseCounters& counters = phases[phase];
+	counters.count.fetch_add(1, std::memory_order_relaxed);
+	counters.total.fetch_add(duration, std::memory_order_relaxed);
+	counters.bytes.fetch_add(bytes, std::memory_order_relaxed);
+	counters.buckets[getBucket(duration)].fetch_add(1, std::memory_order_relaxed);
+}
+
+std::uint64_t Profiler::getPercentile(ProfilePhase phase, double percentile) const {
+	const PhaseCounters& counters = phases[phase];
+	const std::uint64_t count = counters.count.load(std::memory_order_relaxed);
+	if(!count) {
+		return 0;
+	}
+	const std::uint64_t rank = static_cast<std::uint64_t>(percentile * static_cast<double>(count - 1));
+	std::uint64_t seen = 0;
+	for(std::size_t i = 0; i < HV_CONFIGURATION_PROFILE_BUCKETS; ++i) {
+		seen += counters.buckets[i].load(std::memory_order_relaxed);
+		if(seen > rank) {
+			return getBucketValue(i);
+		}
+	}
+	return getBucketValue(HV_CONFIGURATION_PROFILE_BUCKETS - 1);
+}
+
+std::string Profiler::toJSON() const {
+	std::uint64_t total = 0;
+	for(std::size_t i = 0; i < PROFILE_PHASE_COUNT; ++i) {
+		total += phases[i].total.load(std::memory_order_relaxed);
+	}
+
+	std::ostringstream json;
+	json << "{\"total_ns\":" << total << ",\"phases\":[";
+	for(std::size_t i = 0; i < PROFILE_PHASE_COUNT; ++i) {
+		const PhaseCounters& counters = phases[i];
+		const ProfilePhase phase = static_cast<ProfilePhase>(i);
+		json << (i ? "," : "") << "{\"name\":\"" << phaseNames[i] << "\""
+				<< ",\"count\":" << counters.count.load(std::memory_order_relaxed)
+				<< ",\"total_ns\":" << counters.total.load(std::memory_order_relaxed)
+				<< ",\"p50_ns\":" << getPercentile(phase, 0.5)
+				<< ",\"p99_ns\":" << getPercentile(phase, 0.99)
+				<< ",\"bytes\":" << counters.bytes.load(std::memory_order_relaxed) << "}";
+	}
+	json << "]}";
+	return json.str();
+}
+
+bool Profiler::report() const {
+	const std::string json(toJSON());
+	HV_LOG_INFO("Configuration profile: {}", json);
+
+	if(reportPath.empty()) {
+		return true;
+	}
+	std::ofstream file(reportPath.c_str(), std::ios::out | std::ios::trunc);
+	file << json << std::endl;
+	if(!file) {
+		HV_LOG_ERROR("Unable to write the configuration profile to {}", reportPath);
+		return false;
+	}
+	return true;
+}
+
+void Profiler::reset() {
+	for(std::size_t i = 0; i < PROFILE_PHASE_COUNT; ++i) {
+		PhaseCounters& counters = phases[i];
+		counters.count = 0;
+		counters.total = 0;
+		counters.bytes = 0;
+		for(std::size_t j = 0; j < HV_CONFIGURATION_PROFILE_BUCKETS; ++j) {
+			counters.buckets[j] = 0;
+		}
+	}
+}
+
+void Profiler::stage_callback(const sc_core::sc_stage& stage) {
+	if(stage == sc_core::SC_POST_END_OF_ELABORATION && isEnabled()) {
+		report();
+	}
+}
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
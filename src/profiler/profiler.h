@@ -0,0 +1,193 @@
+/*
+ * @file profiler.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Elaboration profiling of the configuration layer
+ */
+
+#ifndef HV_CONFIGURATION_PROFILER_H
+#define HV_CONFIGURATION_PROFILER_H
+
+#include "../configuration/common.h"
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <string>
+
+#include <systemc>
+
+/// Environment variable enabling the profiler: "1" or the JSON report path
+#define HV_CONFIGURATION_PROFILE_ENV "HVCFG_PROFILE"
+
+/// Default JSON report path
+#define HV_CONFIGURATION_PROFILE_DEFAULT_PATH "hvcfg-profile.json"
+
+/// Histogram buckets per power of two
+#define HV_CONFIGURATION_PROFILE_SUB_BUCKETS 8
+
+/// Histogram buckets per phase
+#define HV_CONFIGURATION_PROFILE_BUCKETS (64 * HV_CONFIGURATION_PROFILE_SUB_BUCKETS)
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+enum ProfilePhase {
+	/// Configuration file loading and parsing
+	PROFILE_YAML_LOAD,
+	/// Parameter hierarchical name generation and registration
+	PROFILE_NAME_GENERATION,
+	/// Preset value lookup and conversion at parameter construction
+	PROFILE_PRESET_RESOLUTION,
+	/// Parameter registration into the broker
+	PROFILE_PARAM_REGISTRATION,
+	/// Parameter registration into the CCI broker
+	PROFILE_CCI_REGISTRATION,
+	PROFILE_PHASE_COUNT
+};
+
+/**
+ * Configuration layer profiler
+ *
+ * Counts calls, time and accounted bytes per phase. Durations are kept in
+ * a log-scale histogram (12.5% resolution) so that memory does not depend on
+ * the number of samples. Counters are atomic: parameters may be created from
+ * several threads.
+ *
+ * Probes are only compiled with HV_CONFIGURATION_PROFILING (ENABLE_PROFILING
+ * CMake option) and are only active if HVCFG_PROFILE is set or if profiling
+ * is enabled by setEnabled(). The summary is reported at the end of
+ * elaboration, as a log line and as a JSON file.
+ */
+class Profiler : public sc_core::sc_stage_callback_if {
+public:
+	/**
+	 * Get the profiler
+	 *
+	 * @return Profiler
+	 */
+	static Profiler& get();
+
+	/**
+	 * Indicates whether profiling is active
+	 *
+	 * @return True if active, otherwise False
+	 */
+	bool isEnabled() const {
+		return enabled.load(std::memory_order_relaxed);
+	}
+
+	/**
+	 * Enable or disable profiling
+	 *
+	 * @param enabled True to enable profiling
+	 */
+	void setEnabled(bool enabled);
+
+	/**
+	 * Set the JSON report path
+	 *
+	 * @param path Report path, empty to disable the JSON report
+	 */
+	void setReportPath(const std::string& path);
+
+	/**
+	 * Record a phase sample
+	 *
+	 * @param phase Phase
+	 * @param duration Duration in nanoseconds
+	 * @param bytes Bytes accounted to the phase
+	 */
+	void record(ProfilePhase phase, std::uint64_t duration, std::size_t bytes);
+
+	/**
+	 * Log the summary and write the JSON report
+	 *
+	 * @return True if the JSON report was written (or not requested), otherwise False
+	 */
+	bool report() const;
+
+	/**
+	 * Get the summary as a JSON document
+	 *
+	 * @return JSON summary
+	 */
+	std::string toJSON() const;
+
+	/**
+	 * Reset every counter
+	 */
+	void reset();
+
+	/// @copydoc sc_core::sc_stage_callback_if::stage_callback
+	void stage_callback(const sc_core::sc_stage& stage) override;
+
+private:
+	Profiler();
+
+	/// Duration at a percentile, from the histogram
+	std::uint64_t getPercentile(ProfilePhase phase, double percentile) const;
+
+	struct PhaseCounters {
+		std::atomic<std::uint64_t> count;
+		std::atomic<std::uint64_t> total;
+		std::atomic<std::uint64_t> bytes;
+		std::atomic<std::uint64_t> buckets[HV_CONFIGURATION_PROFILE_BUCKETS];
+	};
+
+	std::atomic<bool> enabled;
+	std::atomic<bool> stageCallbackRegistered;
+	std::string reportPath;
+	PhaseCounters phases[PROFILE_PHASE_COUNT];
+};
+
+/**
+ * Times a scope into a profiler phase
+ */
+class ProfileScope {
+public:
+	explicit ProfileScope(ProfilePhase phase, std::size_t bytes = 0) :
+		phase(phase), bytes(bytes), active(Profiler::get().isEnabled()) {
+		if(active) {
+			start = std::chrono::steady_clock::now();
+		}
+	}
+
+	~ProfileScope() {
+		if(active) {
+			const std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - start;
+			Profiler::get().record(phase, static_cast<std::uint64_t>(duration.count()), bytes);
+		}
+	}
+
+	/**
+	 * Account bytes to the phase
+	 *
+	 * @param size Bytes
+	 */
+	void addBytes(std::size_t size) {
+		bytes += size;
+	}
+
+	ProfileScope(const ProfileScope&) HV_CPLUSPLUS_MEMBER_FUNCTION_DELETE;
+	ProfileScope& operator=(const ProfileScope&) HV_CPLUSPLUS_MEMBER_FUNCTION_DELETE;
+
+private:
+	const ProfilePhase phase;
+	std::size_t bytes;
+	const bool active;
+	std::chrono::steady_clock::time_point start;
+};
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#ifdef HV_CONFIGURATION_PROFILING
+#define HV_CFG_PROFILE_SCOPE(phase) ::hv::cfg::ProfileScope _hvCfgProfileScope(phase)
+#define HV_CFG_PROFILE_BYTES(size) _hvCfgProfileScope.addBytes(size)
+#else
+#define HV_CFG_PROFILE_SCOPE(phase)
+#define HV_CFG_PROFILE_BYTES(size)
+#endif
+
+#endif // HV_CONFIGURATION_PROFILER_H
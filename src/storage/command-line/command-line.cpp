@@ -0,0 +1,212 @@
+/*
+ * @file command-line.cpp
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Command line storage
+ */
+
+#include <algorithm>
+#include <cctype>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+
+#include "command-line.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+CommandLine::CommandLine(int argc, const char* const* argv) :
+		index(), buffers(), overrides(), deleted(), expectOverride(false) {
+	for(int i = 1; i < argc; ++i) {
+		parseArgument(View{argv[i], std::strlen(argv[i])}, 0);
+	}
+	if(expectOverride) {
+		HV_LOG_WARNING("Missing value after {}", HV_CONFIGURATION_STORAGE_COMMAND_LINE_OPTION);
+		expectOverride = false;
+	}
+
+	// Stable sort keeps the command line order among equal keys: keep the last one
+	std::stable_sort(index.begin(), index.end(), [](const Entry& lhs, const Entry& rhs) {
+		const int result = std::memcmp(lhs.key.data, rhs.key.data, std::min(lhs.key.size, rhs.key.size));
+		return result < 0 || (result == 0 && lhs.key.size < rhs.key.size);
+	});
+	std::vector<Entry>::iterator last = index.begin();
+	for(std::vector<Entry>::iterator it = index.begin(); it != index.end(); ++it) {
+		std::vector<Entry>::iterator next = it + 1;
+		if(next != index.end() && next->key.size == it->key.size
+				&& std::memcmp(next->key.data, it->key.data, it->key.size) == 0) {
+			continue;
+		}
+		*last++ = *it;
+	}
+	index.erase(last, index.end());
+
+	HV_LOG_DEBUG("{} command line overrides", index.size());
+}
+
+void CommandLine::parseArgument(View argument, int depth) {
+	static const std::size_t optionSize = std::strlen(HV_CONFIGURATION_STORAGE_COMMAND_LINE_OPTION);
+
+	if(expectOverride) {
+		expectOverride = false;
+		addOverride(argument);
+	} else if(argument.size >= optionSize
+			&& std::memcmp(argument.data, HV_CONFIGURATION_STORAGE_COMMAND_LINE_OPTION, optionSize) == 0) {
+		if(argument.size == optionSize) {
+			expectOverride = true;
+		} else if(argument.data[optionSize] == '=') {
+			addOverride(View{argument.data + optionSize + 1, argument.size - optionSize - 1});
+		}
+	} else if(argument.size > 1 && argument.data[0] == '@') {
+		if(depth >= HV_CONFIGURATION_STORAGE_COMMAND_LINE_MAX_DEPTH) {
+			HV_LOG_ERROR("Too many nested response files, ignoring {}", std::string(argument.data, argument.size));
+			return;
+		}
+		parseResponseFile(std::string(argument.data + 1, argument.size - 1), depth + 1);
+	}
+}
+
+void CommandLine::parseResponseFile(const std::string& filepath, int depth) {
+	std::ifstream file(filepath, std::ios::in | std::ios::binary);
+	if(!file) {
+		HV_LOG_ERROR("Unable to open response file {}", filepath);
+		return;
+	}
+	std::ostringstream content;
+	content << file.rdbuf();
+	buffers.push_back(content.str());
+	const std::string& buffer = buffers.back();
+
+	const char* const end = buffer.data() + buffer.size();
+	for(const char* line = buffer.data(); line < end;) {
+		const char* lineEnd = static_cast<const char*>(std::memchr(line, '\n', end - line));
+		if(!lineEnd) {
+			lineEnd = end;
+		}
+		const char* first = line;
+		const char* last = lineEnd;
+		while(first < last && std::isspace(static_cast<unsigned char>(*first))) {
+			++first;
+		}
+		while(last > first && std::isspace(static_cast<unsigned char>(last[-1]))) {
+			--last;
+		}
+		line = lineEnd + 1;
+		if(first == last || *first == '#') {
+			continue;
+		}
+
+		// "--param key=value" on a single line
+		const std::size_t optionSize = std::strlen(HV_CONFIGURATION_STORAGE_COMMAND_LINE_OPTION);
+		if(static_cast<std::size_t>(last - first) > optionSize
+				&& std::memcmp(first, HV_CONFIGURATION_STORAGE_COMMAND_LINE_OPTION, optionSize) == 0
+				&& std::isspace(static_cast<unsigned char>(first[optionSize]))) {
+			first += optionSize;
+			while(first < last && std::isspace(static_cast<unsigned char>(*first))) {
+				++first;
+			}
+			addOverride(View{first, static_cast<std::size_t>(last - first)});
+		} else if(*first == '@' || *first == '-') {
+			parseArgument(View{first, static_cast<std::size_t>(last - first)}, depth);
+		} else {
+			addOverride(View{first, static_cast<std::size_t>(last - first)});
+		}
+	}
+}
+
+void CommandLine::addOverride(View override) {
+	const char* equal = static_cast<const char*>(std::memchr(override.data, '=', override.size));
+	if(!equal || equal == override.data) {
+		HV_LOG_WARNING("Ignoring malformed override {}, expecting key=value", std::string(override.data, override.size));
+		return;
+	}
+	const char* keyEnd = equal;
+	while(keyEnd > override.data && std::isspace(static_cast<unsigned char>(keyEnd[-1]))) {
+		--keyEnd;
+	}
+	const char* value = equal + 1;
+	const char* valueEnd = override.data + override.size;
+	while(value < valueEnd && std::isspace(static_cast<unsigned char>(*value))) {
+		++value;
+	}
+	index.push_back(Entry{View{override.data, static_cast<std::size_t>(keyEnd - override.data)},
+			View{value, static_cast<std::size_t>(valueEnd - value)}});
+}
+
+int CommandLine::compare(const View& lhs, const std::string& rhs) {
+	const int result = std::memcmp(lhs.data, rhs.data(), std::min(lhs.size, rhs.size()));
+	if(result != 0) {
+		return result;
+	}
+	return (lhs.size < rhs.size()) ? -1 : ((lhs.size > rhs.size()) ? 1 : 0);
+}
+
+const CommandLine::Entry* CommandLine::findEntry(const std::string& key) const {
+	std::vector<Entry>::const_iterator it = std::lower_bound(index.begin(), index.end(), key,
+			[](const Entry& entry, const std::string& value) {
+		return compare(entry.key, value) < 0;
+	});
+	if(it != index.end() && compare(it->key, key) == 0 && deleted.find(key) == deleted.end()) {
+		return &(*it);
+	}
+	return nullptr;
+}
+
+void CommandLine::setValue(const std::string& key, const std::string& value) {
+	overrides[key] = value;
+	deleted.erase(key);
+}
+
+std::string CommandLine::getValue(const std::string& key) const {
+	auto it = overrides.find(key);
+	if(it != overrides.end()) {
+		return it->second;
+	}
+	const Entry* entry = findEntry(key);
+	if(entry) {
+		return std::string(entry->value.data, entry->value.size);
+	}
+	return std::string();
+}
+
+std::map<std::string, std::string> CommandLine::getValues(const std::string& keyPrefix) const {
+	std::map<std::string, std::string> result;
+	for(auto const &entry : index) {
+		std::string key(entry.key.data, entry.key.size);
+		if((keyPrefix.empty() || key.find(keyPrefix) != std::string::npos)
+				&& deleted.find(key) == deleted.end()) {
+			result[key] = std::string(entry.value.data, entry.value.size);
+		}
+	}
+	for(auto const &entry : overrides) {
+		if(keyPrefix.empty() || entry.first.find(keyPrefix) != std::string::npos) {
+			result[entry.first] = entry.second;
+		}
+	}
+	return result;
+}
+
+bool CommandLine::hasValue(const std::string& key) const {
+	return overrides.find(key) != overrides.end() || findEntry(key) != nullptr;
+}
+
+void CommandLine::deleteValue(const std::string& key) {
+	overrides.erase(key);
+	deleted.insert(key);
+}
+
+bool CommandLine::reset() {
+	index.clear();
+	buffers.clear();
+	overrides.clear();
+	deleted.clear();
+	return true;
+}
+
+std::size_t CommandLine::getOverrideCount() const {
+	return index.size();
+}
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
@@ -0,0 +1,117 @@
+/*
+ * @file command-line.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Command line storage
+ */
+
+#ifndef HV_CONFIGURATION_STORAGE_COMMAND_LINE_H
+#define HV_CONFIGURATION_STORAGE_COMMAND_LINE_H
+
+#include <deque>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "../../configuration/common.h"
+#include "../storage-if.h"
+
+/// Command line option introducing an override
+#define HV_CONFIGURATION_STORAGE_COMMAND_LINE_OPTION "--param"
+
+/// Maximum nesting of response files
+#define HV_CONFIGURATION_STORAGE_COMMAND_LINE_MAX_DEPTH 8
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+/**
+ * Command line storage
+ *
+ * Overrides are given as "--param top.cpu.freq=2000000000" or
+ * "--param=top.cpu.freq=2000000000". "@file" reads a response file holding one
+ * override per line ("--param" being optional there, '#' starting a comment).
+ * Values are JSON literals, anything else is a string. Other arguments are
+ * ignored.
+ *
+ * Nothing is copied: keys and values are views into argv and into the response
+ * file buffers, indexed by a sorted vector. argv must outlive the storage.
+ * When a key is given several times, the last occurrence wins.
+ */
+class CommandLine : public StorageIf {
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param argc Argument count
+	 * @param argv Arguments
+	 */
+	CommandLine(int argc, const char* const* argv);
+
+	~CommandLine() override HV_CPLUSPLUS_MEMBER_FUNCTION_DEFAULT;
+
+public:
+	void setValue(const std::string& key, const std::string& value) override;
+
+	std::string getValue(const std::string& key) const override;
+
+	std::map<std::string, std::string> getValues(const std::string& keyPrefix = "") const override;
+
+	bool hasValue(const std::string& key) const override;
+
+	void deleteValue(const std::string& key) override;
+
+	bool reset() override;
+
+	/**
+	 * Get the number of parsed overrides
+	 *
+	 * @return Number of distinct keys given on the command line
+	 */
+	std::size_t getOverrideCount() const;
+
+protected:
+	/// Non-owning view of characters
+	struct View {
+		const char* data;
+		std::size_t size;
+	};
+
+	/// Indexed override
+	struct Entry {
+		View key;
+		View value;
+	};
+
+	void parseArgument(View argument, int depth);
+
+	void parseResponseFile(const std::string& filepath, int depth);
+
+	void addOverride(View override);
+
+	const Entry* findEntry(const std::string& key) const;
+
+	static int compare(const View& lhs, const std::string& rhs);
+
+private:
+	/// Overrides sorted by key, last occurrence only
+	std::vector<Entry> index;
+
+	/// Response files content (stable addresses)
+	std::deque<std::string> buffers;
+
+	/// Values set after parsing
+	std::map<std::string, std::string> overrides;
+
+	/// Parsed keys deleted after parsing
+	std::set<std::string> deleted;
+
+	/// Whether the next argument is the value of --param
+	bool expectOverride;
+};
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_STORAGE_COMMAND_LINE_H
@@ -9,50 +9,41 @@
 
 #include <cstdlib>
 #include <cstdio>
+#include <cstring>
 #include <sstream>
 
 #include "environment.h"
 
-HV_CONFIGURATION_OPEN_NAMESPACE
-
 extern char **environ;
 
-Environment::Environment() : storage() {
-	std::map<std::string, std::string> storage;
-	int i = 1;
-	char *s = *environ;
+HV_CONFIGURATION_OPEN_NAMESPACE
 
-	for (; s; i++) {
-		std::string envVar = std::string(s);
-		std::string::size_type index = envVar.find("=");
-		if (index == std::string::npos) {
-			// TODO: error, unable to read env var
-		} else {
-			std::string envVarName = envVar.substr(0, index);
-			std::string envVarValue = envVar.substr(index + 1);
-			storage[envVarName] = envVarValue;
-		}
-		s = *(environ+i);
-	}
+Environment::Environment(const std::string& prefix) :
+		storage(), indexed(false), prefix(prefix) {
 }
 
 void Environment::setValue(const std::string& key, const std::string& value) {
 #ifdef _WIN32
-	_putenv_s(getPrefixedKey(key).c_str(), value.c_str());
+	_putenv_s(getVariableName(key).c_str(), value.c_str());
 #else
-	setenv(getPrefixedKey(key).c_str(), value.c_str(), true);
+	setenv(getVariableName(key).c_str(), value.c_str(), true);
 #endif
+	if(indexed) {
+		storage[key] = value;
+	}
 }
 
 std::string Environment::getValue(const std::string& key) const {
-	if (hasValue(getPrefixedKey(key))) {
-		return storage.at(getPrefixedKey(key));
+	const char* value = std::getenv(getVariableName(key).c_str());
+	if (value) {
+		return std::string(value);
 	} else {
 		return std::string();
 	}
 }
 
 std::map<std::string, std::string> Environment::getValues(const std::string& keyPrefix) const {
+	buildIndex();
 	std::map<std::string, std::string> result;
 	if(!keyPrefix.empty()) {
 		for(auto const &entry : storage) {
@@ -67,38 +58,89 @@ std::map<std::string, std::string> Environment::getValues(const std::string& key
 }
 
 bool Environment::hasValue(const std::string& key) const {
-	return storage.find(getPrefixedKey(key)) != storage.end();
+	return std::getenv(getVariableName(key).c_str()) != nullptr;
 }
 
 void Environment::deleteValue(const std::string& key) {
 #ifdef _WIN32
-		_putenv_s(getPrefixedKey(key).c_str(), "");
+		_putenv_s(getVariableName(key).c_str(), "");
 #else
-		unsetenv(getPrefixedKey(key).c_str());
+		unsetenv(getVariableName(key).c_str());
 #endif
-		storage.erase(getPrefixedKey(key));
+		storage.erase(key);
 }
 
 bool Environment::reset() {
-	for(auto const &entry : storage) {
-		deleteValue(entry.first);
+	// Without prefix, the whole process environment would be wiped out
+	if(!prefix.empty()) {
+		buildIndex();
+		for(auto const &entry : storage) {
+#ifdef _WIN32
+			_putenv_s(getVariableName(entry.first).c_str(), "");
+#else
+			unsetenv(getVariableName(entry.first).c_str());
+#endif
+		}
 	}
 	storage.clear();
+	indexed = false;
 	return true;
 }
 
-std::string Environment::getPrefixedKey(const std::string& key) const {
-	if(!prefix.empty()) {
-#if defined(_MSC_VER) && _MSC_VER <= 1700
-		std::stringstream prefixedKey;
-		prefixedKey << prefix << HV_CONFIGURATION_STORAGE_SEPARATOR << key;
-		return prefixedKey.str();
-#else
-		return prefix + HV_CONFIGURATION_STORAGE_SEPARATOR + key;
-#endif
-	} else {
+std::string Environment::getVariableName(const std::string& key) const {
+	if(prefix.empty()) {
 		return key;
 	}
+	std::string variableName(prefix);
+	variableName.reserve(prefix.size() + key.size() + 8);
+	std::string::size_type start = 0;
+	std::string::size_type separator = key.find(HV_CONFIGURATION_STORAGE_SEPARATOR);
+	while(separator != std::string::npos) {
+		variableName.append(key, start, separator - start);
+		variableName.append(HV_CONFIGURATION_STORAGE_ENVIRONMENT_SEPARATOR);
+		start = separator + 1;
+		separator = key.find(HV_CONFIGURATION_STORAGE_SEPARATOR, start);
+	}
+	variableName.append(key, start, std::string::npos);
+	return variableName;
+}
+
+std::string Environment::getKey(const std::string& variableName) const {
+	if(prefix.empty()) {
+		return variableName;
+	}
+	const std::string separator(HV_CONFIGURATION_STORAGE_ENVIRONMENT_SEPARATOR);
+	std::string key;
+	key.reserve(variableName.size() - prefix.size());
+	std::string::size_type start = prefix.size();
+	std::string::size_type next = variableName.find(separator, start);
+	while(next != std::string::npos) {
+		key.append(variableName, start, next - start);
+		key.append(HV_CONFIGURATION_STORAGE_SEPARATOR);
+		start = next + separator.size();
+		next = variableName.find(separator, start);
+	}
+	key.append(variableName, start, std::string::npos);
+	return key;
+}
+
+void Environment::buildIndex() const {
+	if(indexed) {
+		return;
+	}
+	for (char** env = environ; env && *env; ++env) {
+		const char* s = *env;
+		if (!prefix.empty() && std::strncmp(s, prefix.c_str(), prefix.size()) != 0) {
+			continue;
+		}
+		const char* equal = std::strchr(s, '=');
+		if (!equal) {
+			HV_LOG_WARNING("Unable to read environment variable {}", s);
+			continue;
+		}
+		storage[getKey(std::string(s, equal))] = std::string(equal + 1);
+	}
+	indexed = true;
 }
 
 HV_CONFIGURATION_CLOSE_NAMESPACE
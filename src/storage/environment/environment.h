@@ -17,11 +17,28 @@
 #include "../../configuration/common.h"
 #include "../storage-if.h"
 
+/// Separator replacing the hierarchy separator in prefixed variable names
+#define HV_CONFIGURATION_STORAGE_ENVIRONMENT_SEPARATOR "__"
+
 HV_CONFIGURATION_OPEN_NAMESPACE
 
+/**
+ * Environment storage
+ *
+ * Nothing is read at construction. Lookups are answered on demand from the
+ * process environment. With a prefix (e.g. "HVCFG_"), only variables starting
+ * with it are exposed and HVCFG_top__cpu__freq is seen as top.cpu.freq.
+ * Enumeration (getValues) builds a small index of these variables on first
+ * use, kept in sync by setValue and deleteValue.
+ */
 class Environment : public StorageIf {
 public:
-	Environment();
+	/**
+	 * Constructor
+	 *
+	 * @param prefix Variable name prefix, empty to expose all variables as is
+	 */
+	Environment(const std::string& prefix = "");
 
 	~Environment() override HV_CPLUSPLUS_MEMBER_FUNCTION_DEFAULT;
 
@@ -39,9 +56,31 @@ public:
 	bool reset() override;
 
 protected:
-	std::string getPrefixedKey(const std::string& key) const;
-
-	std::map<std::string, std::string> storage;
+	/**
+	 * Get the variable name of a hierarchical key
+	 *
+	 * @param key Hierarchical key (top.cpu.freq)
+	 *
+	 * @return Variable name (HVCFG_top__cpu__freq)
+	 */
+	std::string getVariableName(const std::string& key) const;
+
+	/**
+	 * Get the hierarchical key of a variable name
+	 *
+	 * @param variableName Variable name (HVCFG_top__cpu__freq)
+	 *
+	 * @return Hierarchical key (top.cpu.freq)
+	 */
+	std::string getKey(const std::string& variableName) const;
+
+	void buildIndex() const;
+
+	/// Index of matching variables by hierarchical key, built on first enumeration
+	mutable std::map<std::string, std::string> storage;
+
+	/// Whether the index has been built
+	mutable bool indexed;
 
 private:
 	const std::string prefix;
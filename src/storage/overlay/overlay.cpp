@@ -0,0 +1,177 @@
+/*
+ * @file overlay.cpp
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Lazy overlay storage
+ */
+
+#include "../storage-helper.h"
+#include "overlay.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+Overlay::Overlay(std::vector<StorageIf*> layers) :
+		layers(), overrides(), cache() {
+	for(auto layer : layers) {
+		addLayer(layer);
+	}
+}
+
+void Overlay::addLayer(StorageIf* layer) {
+	if(layer) {
+		layers.push_back(layer);
+		cache.clear();
+	}
+}
+
+std::size_t Overlay::getLayerCount() const {
+	return layers.size();
+}
+
+void Overlay::setLayerValue(std::size_t layer, const std::string& key, const std::string& value) {
+	if(layer < layers.size()) {
+		layers[layer]->setValue(key, value);
+		invalidate(key);
+	} else {
+		HV_LOG_ERROR("Overlay has no layer {}", layer);
+	}
+}
+
+void Overlay::deleteLayerValue(std::size_t layer, const std::string& key) {
+	if(layer < layers.size()) {
+		layers[layer]->deleteValue(key);
+		invalidate(key);
+	} else {
+		HV_LOG_ERROR("Overlay has no layer {}", layer);
+	}
+}
+
+void Overlay::invalidate(const std::string& key) {
+	// The key itself
+	cache.erase(key);
+
+	// Parents, their resolved map includes this key
+	std::string::size_type separator = key.rfind(HV_CONFIGURATION_STORAGE_SEPARATOR);
+	while(separator != std::string::npos) {
+		cache.erase(key.substr(0, separator));
+		separator = separator ? key.rfind(HV_CONFIGURATION_STORAGE_SEPARATOR, separator - 1) : std::string::npos;
+	}
+
+	// Children, a map written at this key may shadow them
+	const std::string searchPrefix = key + HV_CONFIGURATION_STORAGE_SEPARATOR;
+	std::map<std::string, Resolution>::iterator first = cache.lower_bound(searchPrefix);
+	std::map<std::string, Resolution>::iterator last = first;
+	while(last != cache.end() && last->first.compare(0, searchPrefix.size(), searchPrefix) == 0) {
+		++last;
+	}
+	cache.erase(first, last);
+}
+
+const Overlay::Resolution& Overlay::resolve(const std::string& key) const {
+	std::map<std::string, Resolution>::const_iterator it = cache.find(key);
+	if(it != cache.end()) {
+		return it->second;
+	}
+
+	Resolution& resolution = cache[key];
+	resolution.found = false;
+	const std::size_t layerCount = layers.size() + 1;
+	for(std::size_t i = layerCount; i-- > 0;) {
+		::cci::cci_value value;
+		if(i == layers.size()) {
+			// Overrides hold leaves: a map written here also answers its children
+			if(!findStorageValue(overrides, key, value)) {
+				continue;
+			}
+		} else if(layers[i]->hasValue(key)) {
+			value = layers[i]->getCCIValue(key);
+		} else {
+			continue;
+		}
+		if(!resolution.found) {
+			resolution.found = true;
+			resolution.value = value;
+			if(!value.is_map()) {
+				break;
+			}
+		} else if(value.is_map()) {
+			// Lower layers complete the map resolved so far
+			resolution.value = mergeStorageValues(value, resolution.value);
+		} else {
+			break;
+		}
+	}
+	return resolution;
+}
+
+void Overlay::setValue(const std::string& key, const std::string& value) {
+	setStorageValue(overrides, key, parseStorageValue(value));
+	invalidate(key);
+}
+
+std::string Overlay::getValue(const std::string& key) const {
+	const Resolution& resolution = resolve(key);
+	if(resolution.found) {
+		return formatStorageValue(resolution.value);
+	} else {
+		return std::string();
+	}
+}
+
+std::map<std::string, std::string> Overlay::getValues(const std::string& keyPrefix) const {
+	std::map<std::string, std::string> result;
+	for(auto layer : layers) {
+		for(auto const &entry : layer->getValues(keyPrefix)) {
+			result[entry.first] = entry.second;
+		}
+	}
+	for(auto const &entry : overrides) {
+		if(keyPrefix.empty() || entry.first.find(keyPrefix) != std::string::npos) {
+			result[entry.first] = formatStorageValue(entry.second);
+		}
+	}
+	return result;
+}
+
+bool Overlay::hasValue(const std::string& key) const {
+	return resolve(key).found;
+}
+
+void Overlay::deleteValue(const std::string& key) {
+	eraseStorageValue(overrides, key);
+	invalidate(key);
+}
+
+bool Overlay::reset() {
+	overrides.clear();
+	cache.clear();
+	return true;
+}
+
+::cci::cci_value Overlay::getCCIValue(const std::string& key) const {
+	return resolve(key).value;
+}
+
+void Overlay::setCCIValue(const std::string& key, const ::cci::cci_value& value) {
+	setStorageValue(overrides, key, value);
+	invalidate(key);
+}
+
+std::map<std::string, ::cci::cci_value> Overlay::getCCIValues(const std::string& keyPrefix) const {
+	std::map<std::string, ::cci::cci_value> result;
+	for(auto layer : layers) {
+		for(auto const &entry : layer->getCCIValues(keyPrefix)) {
+			result[entry.first] = entry.second;
+		}
+	}
+	for(auto const &entry : overrides) {
+		if(keyPrefix.empty() || entry.first.find(keyPrefix) != std::string::npos) {
+			result[entry.first] = entry.second;
+		}
+	}
+	return result;
+}
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
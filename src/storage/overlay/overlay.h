@@ -0,0 +1,126 @@
+/*
+ * @file overlay.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Lazy overlay storage
+ */
+
+#ifndef HV_CONFIGURATION_STORAGE_OVERLAY_H
+#define HV_CONFIGURATION_STORAGE_OVERLAY_H
+
+#include <iostream>
+#include <vector>
+#include <map>
+
+#include "../../configuration/common.h"
+#include "../storage-if.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+/**
+ * Lazy overlay of storages
+ *
+ * Layers are never merged: a key is resolved on first access by checking the
+ * layers from the highest to the lowest priority, and the answer is cached.
+ * Writes through the overlay go to an internal top layer. Writes to a lower
+ * layer must go through setLayerValue() (or be followed by invalidate()) so
+ * that only the affected keys are dropped from the cache.
+ */
+class Overlay : public StorageIf {
+public:
+	/**
+	 * Constructor
+	 *
+	 * @param layers Layers by increasing priority (not owned)
+	 */
+	Overlay(std::vector<StorageIf*> layers = std::vector<StorageIf*>());
+
+	~Overlay() override HV_CPLUSPLUS_MEMBER_FUNCTION_DEFAULT;
+
+	/**
+	 * Add a layer with a higher priority than the existing ones
+	 *
+	 * The internal top layer keeps the highest priority.
+	 *
+	 * @param layer Layer (not owned)
+	 */
+	void addLayer(StorageIf* layer);
+
+	/**
+	 * Get the number of layers, internal top layer excluded
+	 *
+	 * @return Number of layers
+	 */
+	std::size_t getLayerCount() const;
+
+	/**
+	 * Write a value to a given layer
+	 *
+	 * @param layer Layer index (0 is the lowest priority)
+	 * @param key Key
+	 * @param value Value
+	 */
+	void setLayerValue(std::size_t layer, const std::string& key, const std::string& value);
+
+	/**
+	 * Delete a value from a given layer
+	 *
+	 * @param layer Layer index (0 is the lowest priority)
+	 * @param key Key
+	 */
+	void deleteLayerValue(std::size_t layer, const std::string& key);
+
+	/**
+	 * Drop the cached resolution of a key, of its parents and of its children
+	 *
+	 * @param key Key
+	 */
+	void invalidate(const std::string& key);
+
+public:
+	void setValue(const std::string& key, const std::string& value) override;
+
+	std::string getValue(const std::string& key) const override;
+
+	std::map<std::string, std::string> getValues(const std::string& keyPrefix) const override;
+
+	bool hasValue(const std::string& key) const override;
+
+	void deleteValue(const std::string& key) override;
+
+	bool reset() override;
+
+	::cci::cci_value getCCIValue(const std::string& key) const override;
+
+	void setCCIValue(const std::string& key, const ::cci::cci_value& value) override;
+
+	std::map<std::string, ::cci::cci_value> getCCIValues(const std::string& keyPrefix) const override;
+
+protected:
+	/// Resolved key
+	struct Resolution {
+		/// Whether a layer provides the key
+		bool found;
+
+		/// Resolved value, maps merged across layers
+		::cci::cci_value value;
+	};
+
+	const Resolution& resolve(const std::string& key) const;
+
+private:
+	/// Layers by increasing priority
+	std::vector<StorageIf*> layers;
+
+	/// Top layer receiving writes made through the overlay, flattened into leaves
+	std::map<std::string, ::cci::cci_value> overrides;
+
+	/// Resolution cache
+	mutable std::map<std::string, Resolution> cache;
+};
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_STORAGE_OVERLAY_H
@@ -0,0 +1,138 @@
+/*
+ * @file storage-helper.cpp
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Storage helpers
+ */
+
+#include "storage-helper.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+::cci::cci_value parseStorageValue(const std::string& value) {
+	::cci::cci_value result;
+	if(value.empty() || !result.json_deserialize(value)) {
+		result.set_string(value);
+	}
+	return result;
+}
+
+std::string formatStorageValue(const ::cci::cci_value& value) {
+	if(value.is_string()) {
+		return value.get_string();
+	} else {
+		return value.to_json();
+	}
+}
+
+::cci::cci_value buildStorageTree(std::map<std::string, ::cci::cci_value>::const_iterator& it,
+		std::map<std::string, ::cci::cci_value>::const_iterator end,
+		const std::string& searchPrefix) {
+	::cci::cci_value_map result;
+	while(it != end && it->first.compare(0, searchPrefix.size(), searchPrefix) == 0) {
+		std::string::size_type separator = it->first.find(HV_CONFIGURATION_STORAGE_SEPARATOR, searchPrefix.size());
+		if(separator == std::string::npos) {
+			result.push_entry(it->first.substr(searchPrefix.size()), it->second);
+			++it;
+		} else {
+			std::string childKey = it->first.substr(searchPrefix.size(), separator - searchPrefix.size());
+			result.push_entry(childKey, buildStorageTree(it, end, it->first.substr(0, separator + 1)));
+		}
+	}
+	return ::cci::cci_value(result);
+}
+
+bool findStorageValue(const std::map<std::string, ::cci::cci_value>& storage,
+		const std::string& key,
+		::cci::cci_value& value) {
+	std::map<std::string, ::cci::cci_value>::const_iterator it = storage.find(key);
+	if(it != storage.end()) {
+		value = it->second;
+		return true;
+	}
+
+	// Maps are not stored, they are rebuilt from their sorted leaves
+	const std::string searchPrefix = key + HV_CONFIGURATION_STORAGE_SEPARATOR;
+	it = storage.lower_bound(searchPrefix);
+	if(it != storage.end() && it->first.compare(0, searchPrefix.size(), searchPrefix) == 0) {
+		value = buildStorageTree(it, storage.end(), searchPrefix);
+		return true;
+	}
+	return false;
+}
+
+bool hasStorageValue(const std::map<std::string, ::cci::cci_value>& storage,
+		const std::string& key) {
+	if(storage.find(key) != storage.end()) {
+		return true;
+	}
+	const std::string searchPrefix = key + HV_CONFIGURATION_STORAGE_SEPARATOR;
+	std::map<std::string, ::cci::cci_value>::const_iterator it = storage.lower_bound(searchPrefix);
+	return it != storage.end() && it->first.compare(0, searchPrefix.size(), searchPrefix) == 0;
+}
+
+namespace {
+
+/// Insert a value, maps being flattened into their leaves
+void insertStorageValue(std::map<std::string, ::cci::cci_value>& storage,
+		const std::string& key,
+		const ::cci::cci_value& value) {
+	if(value.is_map()) {
+		for(auto const &entry : value.get_map()) {
+			insertStorageValue(storage, key + HV_CONFIGURATION_STORAGE_SEPARATOR + std::string(entry.key),
+					entry.value);
+		}
+	} else {
+		storage[key] = value;
+	}
+}
+
+} // namespace
+
+void setStorageValue(std::map<std::string, ::cci::cci_value>& storage,
+		const std::string& key,
+		const ::cci::cci_value& value) {
+	eraseStorageValue(storage, key);
+	insertStorageValue(storage, key, value);
+}
+
+void eraseStorageValue(std::map<std::string, ::cci::cci_value>& storage,
+		const std::string& key) {
+	storage.erase(key);
+
+	const std::string searchPrefix = key + HV_CONFIGURATION_STORAGE_SEPARATOR;
+	std::map<std::string, ::cci::cci_value>::iterator begin = storage.lower_bound(searchPrefix);
+	std::map<std::string, ::cci::cci_value>::iterator end = begin;
+	while(end != storage.end() && end->first.compare(0, searchPrefix.size(), searchPrefix) == 0) {
+		++end;
+	}
+	storage.erase(begin, end);
+}
+
+::cci::cci_value mergeStorageValues(const ::cci::cci_value& lower, const ::cci::cci_value& upper) {
+	if(!lower.is_map() || !upper.is_map()) {
+		return upper;
+	}
+	::cci::cci_value_map result;
+	::cci::cci_value::const_map_reference upperMap = upper.get_map();
+	for(auto const &entry : lower.get_map()) {
+		const std::string key(entry.key);
+		if(upperMap.has_entry(key)) {
+			result.push_entry(key, mergeStorageValues(entry.value, upperMap.at(key)));
+		} else {
+			result.push_entry(key, entry.value);
+		}
+	}
+	::cci::cci_value::const_map_reference lowerMap = lower.get_map();
+	for(auto const &entry : upperMap) {
+		const std::string key(entry.key);
+		if(!lowerMap.has_entry(key)) {
+			result.push_entry(key, entry.value);
+		}
+	}
+	return ::cci::cci_value(result);
+}
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
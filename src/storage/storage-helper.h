@@ -0,0 +1,124 @@
+/*
+ * @file storage-helper.h
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Storage helpers
+ */
+
+#ifndef HV_CONFIGURATION_STORAGE_HELPER_H
+#define HV_CONFIGURATION_STORAGE_HELPER_H
+
+#include <map>
+#include <string>
+
+#include <cci_configuration>
+
+#include "../configuration/common.h"
+#include "storage-if.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+/**
+ * Convert a raw storage string to a CCI value
+ *
+ * JSON literals (numbers, booleans, lists and maps) are parsed, anything else
+ * is kept as a CCI string.
+ *
+ * @param value Raw storage string
+ *
+ * @return CCI value
+ */
+::cci::cci_value parseStorageValue(const std::string& value);
+
+/**
+ * Convert a CCI value to a raw storage string
+ *
+ * Strings are returned as is, anything else is serialized to JSON.
+ *
+ * @param value CCI value
+ *
+ * @return Raw storage string
+ */
+std::string formatStorageValue(const ::cci::cci_value& value);
+
+/**
+ * Build a CCI map from a sorted range of flat keys sharing a prefix
+ *
+ * The iterator is advanced past the last key starting with searchPrefix.
+ *
+ * @param it First entry with searchPrefix
+ * @param end End of the storage
+ * @param searchPrefix Prefix, including the trailing separator
+ *
+ * @return CCI map of the subtree
+ */
+::cci::cci_value buildStorageTree(std::map<std::string, ::cci::cci_value>::const_iterator& it,
+		std::map<std::string, ::cci::cci_value>::const_iterator end,
+		const std::string& searchPrefix);
+
+/**
+ * Get a CCI value from a flat storage, rebuilding the subtree if the key is a map
+ *
+ * Lookup is O(log n + subtree).
+ *
+ * @param storage Flat storage
+ * @param key Key
+ * @param value Output CCI value
+ *
+ * @return True if the key or a subtree has been found, otherwise False
+ */
+bool findStorageValue(const std::map<std::string, ::cci::cci_value>& storage,
+		const std::string& key,
+		::cci::cci_value& value);
+
+/**
+ * Check if a flat storage holds a key or a subtree for this key
+ *
+ * @param storage Flat storage
+ * @param key Key
+ *
+ * @return True if the key or a subtree exists, otherwise False
+ */
+bool hasStorageValue(const std::map<std::string, ::cci::cci_value>& storage,
+		const std::string& key);
+
+/**
+ * Set a value in a flat storage
+ *
+ * Any previous value or subtree of the key is replaced. Maps are stored as
+ * their leaves, as when loading a file.
+ *
+ * @param storage Flat storage
+ * @param key Key
+ * @param value CCI value
+ */
+void setStorageValue(std::map<std::string, ::cci::cci_value>& storage,
+		const std::string& key,
+		const ::cci::cci_value& value);
+
+/**
+ * Erase a key and its subtree from a flat storage
+ *
+ * @param storage Flat storage
+ * @param key Key
+ */
+void eraseStorageValue(std::map<std::string, ::cci::cci_value>& storage,
+		const std::string& key);
+
+/**
+ * Merge two CCI values, upper taking precedence over lower
+ *
+ * Maps are merged recursively, any other value from upper replaces lower.
+ *
+ * @param lower Lower precedence value
+ * @param upper Higher precedence value
+ *
+ * @return Merged value
+ */
+::cci::cci_value mergeStorageValues(const ::cci::cci_value& lower, const ::cci::cci_value& upper);
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_STORAGE_HELPER_H
@@ -0,0 +1,35 @@
+/*
+ * @file storage-if.cpp
+ * @author Guillaume Delbergue <guillaume.delbergue@hiventive.com>
+ * @date October, 2026
+ * @copyright Copyright (C) 2026, Hiventive.
+ *
+ * @brief Storage interface
+ */
+
+#include "storage-if.h"
+#include "storage-helper.h"
+
+HV_CONFIGURATION_OPEN_NAMESPACE
+
+::cci::cci_value StorageIf::getCCIValue(const std::string& key) const {
+	if(hasValue(key)) {
+		return parseStorageValue(getValue(key));
+	} else {
+		return ::cci::cci_value();
+	}
+}
+
+void StorageIf::setCCIValue(const std::string& key, const ::cci::cci_value& value) {
+	setValue(key, value.to_json());
+}
+
+std::map<std::string, ::cci::cci_value> StorageIf::getCCIValues(const std::string& keyPrefix) const {
+	std::map<std::string, ::cci::cci_value> result;
+	for(auto const &entry : getValues(keyPrefix)) {
+		result.insert(result.end(), std::make_pair(entry.first, parseStorageValue(entry.second)));
+	}
+	return result;
+}
+
+HV_CONFIGURATION_CLOSE_NAMESPACE
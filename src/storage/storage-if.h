@@ -15,6 +15,8 @@
 #include <iostream>
 #include <map>
 
+#include <cci_configuration>
+
 #define HV_CONFIGURATION_STORAGE_SEPARATOR "."
 
 HV_CONFIGURATION_OPEN_NAMESPACE
@@ -33,6 +35,39 @@ public:
 
 	virtual bool reset() = 0;
 
+	/**
+	 * Get a value as a CCI value
+	 *
+	 * Default implementation parses the raw string value. Structured storages
+	 * override it to return maps and lists without any string conversion.
+	 *
+	 * @param key Key
+	 *
+	 * @return CCI value, null if the key does not exist
+	 */
+	virtual ::cci::cci_value getCCIValue(const std::string& key) const;
+
+	/**
+	 * Set a value from a CCI value
+	 *
+	 * Default implementation stores the JSON serialization of the value.
+	 *
+	 * @param key Key
+	 * @param value CCI value
+	 */
+	virtual void setCCIValue(const std::string& key, const ::cci::cci_value& value);
+
+	/**
+	 * Get values as CCI values
+	 *
+	 * Default implementation parses the raw string values.
+	 *
+	 * @param keyPrefix Key prefix filter
+	 *
+	 * @return Map of key / CCI value
+	 */
+	virtual std::map<std::string, ::cci::cci_value> getCCIValues(const std::string& keyPrefix = "") const;
+
 	// FIXME
 	// virtual StorageIf& getObject(const std::string& key) const = 0;
 
@@ -11,5 +11,7 @@
 #include "memory/memory.h"
 #include "environment/environment.h"
 #include "yaml/yaml.h"
+#include "overlay/overlay.h"
+#include "command-line/command-line.h"
 
 
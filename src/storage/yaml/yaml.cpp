@@ -11,48 +11,51 @@
 #include <cctype>
 
 #include "../../configuration/common.h"
+#include "../../profiler/profiler.h"
+#include "../storage-helper.h"
 #include "yaml.h"
 
 HV_CONFIGURATION_OPEN_NAMESPACE
 
-YAML::YAML(const std::string& filepath):
-		storage(), filepath(filepath) {
+YAML::YAML(const std::string& filepath, bool exitOnError):
+		storage(), filepath(filepath), loaded(false) {
 	HV_LOG_DEBUG("Opening {}", filepath);
+	HV_CFG_PROFILE_SCOPE(PROFILE_YAML_LOAD);
 	try {
 		::YAML::Node configFile = ::YAML::LoadFile(filepath);
 		parseNode(configFile, "");
+		HV_CFG_PROFILE_BYTES(storage.size() * sizeof(*storage.begin()));
+		loaded = true;
 	} catch (const ::YAML::BadFile& e) {
 		HV_LOG_CRITICAL("Unable to open the configuration file: {} with error: {}", filepath, e.what());
 	} catch(const ::YAML::Exception& e) {
 		HV_LOG_CRITICAL("Unable to parse the configuration file {} with error: {}", filepath, e.what());
-		HV_EXIT_FAILURE();
+		if(exitOnError) {
+			HV_EXIT_FAILURE();
+		}
 	}
 }
 
+bool YAML::isLoaded() const {
+	return loaded;
+}
+
 void YAML::parseNode(const ::YAML::Node& node, const std::string& parentKey) {
 	for (::YAML::const_iterator it = node.begin(); it != node.end(); ++it) {
 		std::string currentKey = parentKey + it->first.as<std::string>();
 		HV_LOG_TRACE("Map with current key {}", currentKey);
 		switch(it->second.Type()) {
 			case ::YAML::NodeType::Map :
-				parseNode(it->second, currentKey + ".");
+				parseNode(it->second, currentKey + HV_CONFIGURATION_STORAGE_SEPARATOR);
 				break;
-			case ::YAML::NodeType::Scalar : {
-				std::string value(it->second.as<std::string>());
-				if(isHexValue(value)) {
-					// Assume all values are unsigned
-					value = std::to_string(std::stoul(value, nullptr, 16));
-				}
-				storage[currentKey] = value;
-				HV_LOG_TRACE("Loaded {} = {}", currentKey, storage[currentKey]);
+			case ::YAML::NodeType::Scalar :
+			case ::YAML::NodeType::Sequence :
+				storage[currentKey] = convertNode(it->second);
+				HV_LOG_TRACE("Loaded {} = {}", currentKey, storage[currentKey].to_json());
 				break;
-			}
 			case ::YAML::NodeType::Null :
 				HV_LOG_ERROR("UNSUPPORTED YAML::NodeType::Null");
 				break;
-			case ::YAML::NodeType::Sequence :
-				HV_LOG_ERROR("UNSUPPORTED YAML::NodeType::Sequence");
-				break;
 			case ::YAML::NodeType::Undefined :
 				HV_LOG_ERROR("UNSUPPORTED YAML::NodeType::Undefined");
 				break;
@@ -60,61 +63,95 @@ void YAML::parseNode(const ::YAML::Node& node, const std::string& parentKey) {
 	}
 }
 
+::cci::cci_value YAML::convertNode(const ::YAML::Node& node) const {
+	switch(node.Type()) {
+		case ::YAML::NodeType::Scalar : {
+			std::string value(node.as<std::string>());
+			if(node.Tag() == "!" || node.Tag() == "tag:yaml.org,2002:str") {
+				// Quoted ("1234", 'true') and !!str scalars are strings, whatever their content
+				::cci::cci_value result;
+				result.set_string(value);
+				return result;
+			}
+			if(isHexValue(value)) {
+				// Assume all values are unsigned
+				value = std::to_string(std::stoul(value, nullptr, 16));
+			}
+			return parseStorageValue(value);
+		}
+		case ::YAML::NodeType::Sequence : {
+			::cci::cci_value_list list;
+			for (::YAML::const_iterator it = node.begin(); it != node.end(); ++it) {
+				list.push_back(convertNode(*it));
+			}
+			return ::cci::cci_value(list);
+		}
+		case ::YAML::NodeType::Map : {
+			::cci::cci_value_map map;
+			for (::YAML::const_iterator it = node.begin(); it != node.end(); ++it) {
+				map.push_entry(it->first.as<std::string>(), convertNode(it->second));
+			}
+			return ::cci::cci_value(map);
+		}
+		case ::YAML::NodeType::Null :
+		case ::YAML::NodeType::Undefined :
+		default:
+			return ::cci::cci_value();
+	}
+}
+
 void YAML::setValue(const std::string& key, const std::string& value) {
 	HV_LOG_TRACE("YAML::setValue with key {} and value {}", key, value);
-	storage[getPrefixedKey(key)] = value;
+	setStorageValue(storage, getPrefixedKey(key), parseStorageValue(value));
 }
 
 std::string YAML::getValue(const std::string& key) const {
 	HV_LOG_TRACE("YAML::getValue with key {}", key);
-	if (hasValue(getPrefixedKey(key))) {
-		if(hasNonPrefixedValue(getPrefixedKey(key))) {
-			return storage.at(getPrefixedKey(key));
-		} else {
-			std::map<std::string, std::string> valuesWithPrefix = getPrefixedValues(getPrefixedKey(key));
-			std::stringstream result;
-			result << "{";
-			bool first = true;
-			for(auto const &entry : valuesWithPrefix) {
-				std::string s = entry.first.substr(getPrefixedKey(key).size() + 1, entry.first.size() - getPrefixedKey(key).size() - 1); // .
-				if(first) {
-					first = false;
-				} else {
-					result << ", ";
-				}
-				result << "\"" << s << "\": ";
-				if(isNumber(entry.second)) {
-					result << entry.second;
-				} else {
-					result << "\"" << entry.second << "\"";
-				}
-			}
-			result << "}";
-			HV_LOG_TRACE("-- YAML::getValue {}", result.str());
-			return result.str();
-		}
-	}
-	else {
+	::cci::cci_value value;
+	if(findStorageValue(storage, getPrefixedKey(key), value)) {
+		return formatStorageValue(value);
+	} else {
 		return std::string();
 	}
 }
 
+::cci::cci_value YAML::getCCIValue(const std::string& key) const {
+	HV_LOG_TRACE("YAML::getCCIValue with key {}", key);
+	::cci::cci_value value;
+	findStorageValue(storage, getPrefixedKey(key), value);
+	return value;
+}
+
+void YAML::setCCIValue(const std::string& key, const ::cci::cci_value& value) {
+	HV_LOG_TRACE("YAML::setCCIValue with key {} and value {}", key, value.to_json());
+	setStorageValue(storage, getPrefixedKey(key), value);
+}
+
 std::map<std::string, std::string> YAML::getValues(const std::string& keyPrefix) const {
 	std::map<std::string, std::string> result;
-	if(!keyPrefix.empty()) {
-		for(auto const &entry : storage) {
-			if (entry.first.find(keyPrefix) != std::string::npos) {
-				result[entry.first] = entry.second;
-			}
+	for(auto const &entry : storage) {
+		if (keyPrefix.empty() || entry.first.find(keyPrefix) != std::string::npos) {
+			result[entry.first] = formatStorageValue(entry.second);
 		}
-		return result;
-	} else {
+	}
+	return result;
+}
+
+std::map<std::string, ::cci::cci_value> YAML::getCCIValues(const std::string& keyPrefix) const {
+	if(keyPrefix.empty()) {
 		return storage;
 	}
+	std::map<std::string, ::cci::cci_value> result;
+	for(auto const &entry : storage) {
+		if (entry.first.find(keyPrefix) != std::string::npos) {
+			result.insert(result.end(), entry);
+		}
+	}
+	return result;
 }
 
 bool YAML::hasValue(const std::string& key) const {
-	return hasNonPrefixedValue(key) || hasPrefixedValue(getPrefixedKey(key));
+	return hasStorageValue(storage, getPrefixedKey(key));
 }
 
 bool YAML::hasNonPrefixedValue(const std::string& key) const {
@@ -122,9 +159,7 @@ bool YAML::hasNonPrefixedValue(const std::string& key) const {
 }
 
 void YAML::deleteValue(const std::string& key) {
-	if (hasValue(getPrefixedKey(key))) {
-		storage.erase(getPrefixedKey(key));
-	}
+	eraseStorageValue(storage, getPrefixedKey(key));
 }
 
 bool YAML::reset() {
@@ -152,34 +187,4 @@ bool YAML::isHexValue(const std::string& value) const {
 		   && value.find_first_not_of("0123456789abcdefABCDEF", 2) == std::string::npos;
 }
 
-// Specific to YAML, a MAP can be available
-bool YAML::hasPrefixedValue(const std::string& searchPrefix) const {
-	std::map<std::string, std::string>::const_iterator i = storage.lower_bound(searchPrefix);
-	if (i != storage.end()) {
-		const std::string& key = i->first;
-		if (key.compare(0, searchPrefix.size(), searchPrefix) == 0)
-			return true;
-		HV_LOG_TRACE("YAML::hasPrefixedValue Results for prefix {}", searchPrefix);
-	}
-	HV_LOG_TRACE("YAML::hasPrefixedValue No result for prefix {}", searchPrefix);
-	return false;
-}
-
-// Specific to YAML, a MAP can be available
-std::map<std::string, std::string> YAML::getPrefixedValues(const std::string& searchPrefix) const {
-			std::map<std::string, std::string> result;
-	for(auto const &entry : storage) {
-		if (entry.first.rfind(searchPrefix, 0) == 0) {
-			result[entry.first] = entry.second;
-		}
-	}
-	return result;
-}
-
-bool YAML::isNumber(const std::string& s) const
-{
-	return !s.empty() && std::find_if(s.begin(),
-									  s.end(), [](char c) { return !std::isdigit(c); }) == s.end();
-}
-
 HV_CONFIGURATION_CLOSE_NAMESPACE
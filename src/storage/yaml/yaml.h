@@ -7,6 +7,9 @@
  * @brief YAML configuration loader
  */
 
+#ifndef HV_CONFIGURATION_STORAGE_YAML_H
+#define HV_CONFIGURATION_STORAGE_YAML_H
+
 #include <iostream>
 #include <vector>
 #include <map>
@@ -19,7 +22,20 @@ HV_CONFIGURATION_OPEN_NAMESPACE
 
 class YAML : public StorageIf {
 public:
-	YAML(const std::string& filename);
+	/**
+	 * Constructor
+	 *
+	 * @param filename YAML file path
+	 * @param exitOnError Whether a parsing error terminates the process
+	 */
+	YAML(const std::string& filename, bool exitOnError = true);
+
+	/**
+	 * Indicates whether the file has been successfully loaded
+	 *
+	 * @return True if the file has been loaded, otherwise False
+	 */
+	bool isLoaded() const;
 
 public:
 	void setValue(const std::string& key, const std::string& value) override;
@@ -34,28 +50,36 @@ public:
 
 	bool reset() override;
 
+	::cci::cci_value getCCIValue(const std::string& key) const override;
+
+	void setCCIValue(const std::string& key, const ::cci::cci_value& value) override;
+
+	std::map<std::string, ::cci::cci_value> getCCIValues(const std::string& keyPrefix) const override;
+
 protected:
 	std::string getPrefixedKey(const std::string& key) const;
 
 	void parseNode(const ::YAML::Node& node, const std::string& parentKey);
 
+	::cci::cci_value convertNode(const ::YAML::Node& node) const;
+
 	bool isHexValue(const std::string& value) const;
 
 	bool hasNonPrefixedValue(const std::string& key) const;
 
-	std::map<std::string, std::string> getPrefixedValues(const std::string& searchPrefix) const;
-
-	bool hasPrefixedValue(const std::string& searchPrefix) const;
-
-	bool isNumber(const std::string& s) const;
-
 protected:
-	std::map<std::string, std::string> storage;
+	/// Leaves (scalars and sequences) by flat key, maps are rebuilt from their leaves
+	std::map<std::string, ::cci::cci_value> storage;
 
 private:
 	const std::string prefix;
 
 	const std::string filepath;
+
+	/// Whether the file has been successfully loaded
+	bool loaded;
 };
 
 HV_CONFIGURATION_CLOSE_NAMESPACE
+
+#endif // HV_CONFIGURATION_STORAGE_YAML_H
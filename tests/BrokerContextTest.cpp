@@ -0,0 +1,45 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+#include <gtest/gtest.h>
+#include <systemc>
+#include <configuration/configuration.h>
+
+TEST(BrokerContextTest, ConcurrentModels) {
+	const int modelCount = 4;
+	const int paramCount = 100;
+	std::vector<int> results(modelCount, -1);
+	std::vector<std::thread> threads;
+
+	hv::cfg::Broker* mainBroker = hv::cfg::getBroker();
+
+	for(int i = 0; i < modelCount; ++i) {
+		threads.push_back(std::thread([i, &results]() {
+			const std::string prefix = "model" + std::to_string(i) + "_param";
+			hv::cfg::Broker broker("Model broker " + std::to_string(i), false);
+			hv::cfg::BrokerContext context(broker);
+			std::vector<std::unique_ptr<hv::cfg::Param<int> > > params;
+			for(int j = 0; j < paramCount; ++j) {
+				params.emplace_back(new hv::cfg::Param<int>(prefix + std::to_string(j), i * paramCount + j));
+			}
+
+			int sum = 0;
+			if(hv::cfg::getBroker() == &broker && broker.getParams().size() == static_cast<std::size_t>(paramCount)) {
+				for(int j = 0; j < paramCount; ++j) {
+					auto param = dynamic_cast<hv::cfg::ParamBase<int>*>(broker.getParam(prefix + std::to_string(j)));
+					sum += param ? param->getValue() : 0;
+				}
+			}
+			results[i] = sum;
+		}));
+	}
+	for(auto &thread : threads) {
+		thread.join();
+	}
+
+	for(int i = 0; i < modelCount; ++i) {
+		EXPECT_EQ(results[i], i * paramCount * paramCount + paramCount * (paramCount - 1) / 2);
+	}
+	EXPECT_EQ(hv::cfg::getBroker(), mainBroker);
+}
@@ -0,0 +1,345 @@
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <type_traits>
+#include <vector>
+#include <gtest/gtest.h>
+#include <systemc>
+#include <configuration/configuration.h>
+
+TEST(CheckpointTest, RoundTrip) {
+	hv::cfg::Param<int> intParam("checkpointInt", 1);
+	hv::cfg::Param<std::string> stringParam("checkpointString", std::string("first"));
+	hv::cfg::Param<std::vector<int> > listParam("checkpointList", std::vector<int>({1, 2, 3}));
+
+	std::stringstream stream;
+	ASSERT_TRUE(hv::cfg::getBroker()->checkpoint(stream));
+
+	intParam = 2;
+	stringParam = std::string("second");
+	listParam = std::vector<int>({4});
+
+	ASSERT_TRUE(hv::cfg::getBroker()->restore(stream));
+	EXPECT_EQ(intParam.getValue(), 1);
+	EXPECT_EQ(stringParam.getValue(), "first");
+	EXPECT_EQ(listParam.getValue(), std::vector<int>({1, 2, 3}));
+}
+
+TEST(CheckpointTest, Delta) {
+	hv::cfg::Param<int> first("checkpointFirst", 1);
+	hv::cfg::Param<int> second("checkpointSecond", 10);
+
+	std::stringstream base;
+	ASSERT_TRUE(hv::cfg::getBroker()->checkpoint(base));
+	EXPECT_FALSE(first.isDirty());
+
+	second = 20;
+	EXPECT_TRUE(second.isDirty());
+	std::stringstream delta;
+	ASSERT_TRUE(hv::cfg::getBroker()->checkpointDelta(delta));
+	EXPECT_FALSE(second.isDirty());
+
+	first = 2;
+	second = 30;
+
+	// A delta cannot be applied on another state than its parent
+	std::stringstream orphan(delta.str());
+	EXPECT_FALSE(hv::cfg::getBroker()->restore(orphan));
+
+	ASSERT_TRUE(hv::cfg::getBroker()->restore(base));
+	ASSERT_TRUE(hv::cfg::getBroker()->restore(delta));
+	EXPECT_EQ(first.getValue(), 1);
+	EXPECT_EQ(second.getValue(), 20);
+}
+
+TEST(CheckpointTest, DeltaAfterDestruction) {
+	std::unique_ptr<hv::cfg::Param<int> > first(new hv::cfg::Param<int>("checkpointDestroyedFirst", 1));
+	hv::cfg::Param<int> second("checkpointKept", 2);
+	std::unique_ptr<hv::cfg::Param<int> > third(new hv::cfg::Param<int>("checkpointDestroyedThird", 3));
+
+	std::stringstream base;
+	ASSERT_TRUE(hv::cfg::getBroker()->checkpoint(base));
+
+	*first = 10;
+	second = 20;
+	*third = 30;
+
+	// The last dirty parameter takes the slot of the first one, then goes away
+	first.reset();
+	third.reset();
+	std::stringstream delta;
+	ASSERT_TRUE(hv::cfg::getBroker()->checkpointDelta(delta));
+	EXPECT_FALSE(second.isDirty());
+
+	second = 40;
+	ASSERT_TRUE(hv::cfg::getBroker()->restore(base));
+	ASSERT_TRUE(hv::cfg::getBroker()->restore(delta));
+	EXPECT_EQ(second.getValue(), 20);
+}
+
+TEST(CheckpointTest, InvalidVector) {
+	hv::cfg::CheckpointWriter writer;
+	writer.write(static_cast<std::uint64_t>(1) << 60);
+	writer.write(static_cast<int>(3));
+	std::stringstream stream;
+	ASSERT_TRUE(writer.flush(stream));
+	const std::string data = stream.str();
+
+	hv::cfg::CheckpointReader reader(data.data(), data.size());
+	std::vector<int> value({1, 2});
+	EXPECT_FALSE(hv::cfg::ParamSerializer<std::vector<int> >::restore(reader, value));
+	EXPECT_EQ(value, std::vector<int>({1, 2}));
+}
+
+TEST(CheckpointTest, RawEncoding) {
+	enum class Mode : std::uint8_t { IDLE, RUN };
+	struct Padded {
+		std::uint8_t tag;
+		std::uint64_t value;
+	};
+
+	// Only arithmetic and enum values are stored as raw bytes
+	EXPECT_TRUE(hv::cfg::ParamSerializerRaw<int>::value);
+	EXPECT_TRUE(hv::cfg::ParamSerializerRaw<double>::value);
+	EXPECT_TRUE(hv::cfg::ParamSerializerRaw<Mode>::value);
+	EXPECT_FALSE(hv::cfg::ParamSerializerRaw<Padded>::value);
+	EXPECT_FALSE(hv::cfg::ParamSerializerRaw<int*>::value);
+
+	hv::cfg::CheckpointWriter writer;
+	const std::array<std::uint16_t, 3> saved = {{1, 2, 3}};
+	hv::cfg::ParamSerializer<std::array<std::uint16_t, 3> >::save(writer, saved);
+	hv::cfg::ParamSerializer<Mode>::save(writer, Mode::RUN);
+	std::stringstream stream;
+	ASSERT_TRUE(writer.flush(stream));
+	const std::string data = stream.str();
+	EXPECT_EQ(data.size(), sizeof(saved) + sizeof(Mode));
+
+	hv::cfg::CheckpointReader reader(data.data(), data.size());
+	std::array<std::uint16_t, 3> restored = {{0, 0, 0}};
+	Mode mode = Mode::IDLE;
+	EXPECT_TRUE((hv::cfg::ParamSerializer<std::array<std::uint16_t, 3> >::restore(reader, restored)));
+	EXPECT_TRUE(hv::cfg::ParamSerializer<Mode>::restore(reader, mode));
+	EXPECT_EQ(restored, saved);
+	EXPECT_TRUE(mode == Mode::RUN);
+}
+
+TEST(CheckpointTest, ArenaSlotReuse) {
+	hv::cfg::Broker broker("Arena reuse broker", false);
+	hv::cfg::BrokerContext context(broker);
+	broker.enableValueArena();
+
+	std::unique_ptr<hv::cfg::Param<int> > first(new hv::cfg::Param<int>("arenaReuseFirst", 1));
+	hv::cfg::Param<std::string> text("arenaReuseText", std::string("outside"));
+	EXPECT_TRUE(first->isInValueArena());
+	EXPECT_FALSE(text.isInValueArena());
+	const int* slot = &first->getValue();
+	first.reset();
+	EXPECT_EQ(broker.getValueArena()->size(), 0u);
+
+	// The released slot is handed out again
+	hv::cfg::Param<int> second("arenaReuseSecond", 2);
+	EXPECT_EQ(&second.getValue(), slot);
+	EXPECT_EQ(second.getValue(), 2);
+	EXPECT_EQ(broker.getValueArena()->size(), 1u);
+}
+
+TEST(CheckpointTest, ArenaSnapshotGeneration) {
+	hv::cfg::Broker broker("Arena generation broker", false);
+	hv::cfg::BrokerContext context(broker);
+	broker.enableValueArena();
+
+	hv::cfg::Param<int> param("arenaGenerationParam", 1);
+	const hv::cfg::ValueArena::Snapshot stale = broker.takeValueSnapshot();
+	{
+		hv::cfg::Param<double> transient("arenaGenerationTransient", 0.5);
+	}
+
+	// The layout changed since the snapshot: it is refused
+	param = 2;
+	EXPECT_FALSE(broker.restoreValueSnapshot(stale));
+	EXPECT_EQ(param.getValue(), 2);
+
+	const hv::cfg::ValueArena::Snapshot current = broker.takeValueSnapshot();
+	param = 3;
+	param.clearDirty();
+	EXPECT_TRUE(broker.restoreValueSnapshot(current));
+	EXPECT_EQ(param.getValue(), 2);
+	EXPECT_TRUE(param.isDirty());
+}
+
+TEST(CheckpointTest, ArenaDetachOnBrokerDestruction) {
+	std::unique_ptr<hv::cfg::Param<int> > param;
+	{
+		hv::cfg::Broker broker("Arena detach broker", false);
+		hv::cfg::BrokerContext context(broker);
+		broker.enableValueArena();
+		param.reset(new hv::cfg::Param<int>("arenaDetachParam", 1));
+		*param = 5;
+		EXPECT_TRUE(param->isInValueArena());
+	}
+
+	// The value is moved back into the parameter
+	EXPECT_FALSE(param->isInValueArena());
+	EXPECT_EQ(param->getValue(), 5);
+	*param = 6;
+	EXPECT_EQ(param->getValue(), 6);
+}
+
+TEST(CheckpointTest, ResetAllModes) {
+	hv::cfg::Broker broker("Reset modes broker", false);
+	hv::cfg::BrokerContext context(broker);
+	broker.enableValueArena();
+	broker.getCCIBroker().set_preset_cci_value("resetModesCount", cci::cci_value(5),
+			cci::cci_originator("CheckpointTest"));
+
+	hv::cfg::Param<int> count("resetModesCount", 1);
+	hv::cfg::Param<std::string> text("resetModesText", std::string("default"));
+	EXPECT_EQ(count.getValue(), 5);
+
+	count = 2;
+	text = std::string("baseline");
+	const hv::cfg::ConfigSnapshot baseline = broker.takeSnapshot();
+	count = 3;
+	text = std::string("modified");
+
+	EXPECT_TRUE(broker.resetAll(hv::cfg::RESET_SNAPSHOT, hv::cfg::RESET_RUN_CALLBACKS, &baseline));
+	EXPECT_EQ(count.getValue(), 2);
+	EXPECT_EQ(text.getValue(), "baseline");
+
+	// Parameters without a preset go back to their default
+	EXPECT_TRUE(broker.resetAll(hv::cfg::RESET_PRESET));
+	EXPECT_EQ(count.getValue(), 5);
+	EXPECT_EQ(text.getValue(), "default");
+
+	EXPECT_TRUE(broker.resetAll(hv::cfg::RESET_DEFAULT));
+	EXPECT_EQ(count.getValue(), 1);
+	EXPECT_FALSE(broker.resetAll(hv::cfg::RESET_SNAPSHOT));
+}
+
+TEST(CheckpointTest, ResetAllLocked) {
+	hv::cfg::Broker broker("Reset lock broker", false);
+	hv::cfg::BrokerContext context(broker);
+	broker.enableValueArena();
+
+	hv::cfg::Param<int> count("resetLockCount", 1);
+	hv::cfg::Param<std::string> text("resetLockText", std::string("default"));
+	count = 2;
+	text = std::string("modified");
+	const cci::cci_originator originator("CheckpointTest");
+	cci::cci_param_untyped_handle countHandle = broker.getCCIBroker().get_param_handle("resetLockCount", originator);
+	cci::cci_param_untyped_handle textHandle = broker.getCCIBroker().get_param_handle("resetLockText", originator);
+	ASSERT_TRUE(countHandle.lock());
+	ASSERT_TRUE(textHandle.lock());
+
+	// Locked parameters refuse the write path
+	EXPECT_FALSE(broker.resetAll(hv::cfg::RESET_DEFAULT, hv::cfg::RESET_RUN_CALLBACKS));
+	EXPECT_EQ(count.getValue(), 2);
+	EXPECT_EQ(text.getValue(), "modified");
+
+	// Direct writes ignore locks, as checkpoint restores do
+	EXPECT_TRUE(broker.resetAll(hv::cfg::RESET_DEFAULT, hv::cfg::RESET_SKIP_CALLBACKS));
+	EXPECT_EQ(count.getValue(), 1);
+	EXPECT_EQ(text.getValue(), "default");
+
+	// Locked parameters already at their target are not failures
+	EXPECT_TRUE(broker.resetAll(hv::cfg::RESET_DEFAULT, hv::cfg::RESET_RUN_CALLBACKS));
+	EXPECT_TRUE(countHandle.is_locked());
+}
+
+TEST(CheckpointTest, ResetAllCallbacks) {
+	hv::cfg::Broker broker("Reset callback broker", false);
+	hv::cfg::BrokerContext context(broker);
+	broker.enableValueArena();
+
+	hv::cfg::Param<int> guarded("resetCallbackGuarded", 1);
+	hv::cfg::Param<int> watched("resetCallbackWatched", 1);
+	guarded = 2;
+	watched = 2;
+
+	const cci::cci_originator originator("CheckpointTest");
+	cci::cci_param_typed_handle<int> guardedHandle(broker.getCCIBroker().get_param_handle("resetCallbackGuarded", originator));
+	cci::cci_param_typed_handle<int> watchedHandle(broker.getCCIBroker().get_param_handle("resetCallbackWatched", originator));
+	guardedHandle.register_pre_write_callback([](const cci::cci_param_write_event<int>&) {
+		return false;
+	});
+	std::vector<int> oldValues;
+	watchedHandle.register_post_write_callback([&](const cci::cci_param_write_event<int>& ev) {
+		oldValues.push_back(ev.old_value);
+	});
+
+	// Callbacks see the reset and may reject it
+	EXPECT_FALSE(broker.resetAll(hv::cfg::RESET_DEFAULT, hv::cfg::RESET_RUN_CALLBACKS));
+	EXPECT_EQ(guarded.getValue(), 2);
+	EXPECT_EQ(watched.getValue(), 1);
+	EXPECT_EQ(oldValues, std::vector<int>({2}));
+
+	watched = 3;
+	EXPECT_TRUE(broker.resetAll(hv::cfg::RESET_DEFAULT, hv::cfg::RESET_SKIP_CALLBACKS));
+	EXPECT_EQ(guarded.getValue(), 1);
+	EXPECT_EQ(watched.getValue(), 1);
+	EXPECT_EQ(oldValues, std::vector<int>({2, 1}));
+	EXPECT_TRUE(watched.isDirty());
+}
+
+TEST(CheckpointTest, DiffEntries) {
+	hv::cfg::Broker broker("Diff entries broker", false);
+	hv::cfg::BrokerContext context(broker);
+	broker.enableValueArena();
+
+	hv::cfg::Param<int> changed("diffChanged", 1);
+	hv::cfg::Param<int> same("diffSame", 1);
+	std::unique_ptr<hv::cfg::Param<std::string> > removed(
+			new hv::cfg::Param<std::string>("diffRemoved", std::string("gone")));
+	const hv::cfg::ConfigSnapshot before = broker.takeSnapshot();
+
+	changed = 2;
+	removed.reset();
+	hv::cfg::Param<std::string> added("diffAdded", std::string("new"));
+
+	hv::cfg::ConfigDiff diff;
+	EXPECT_TRUE(broker.diff(before, diff));
+	ASSERT_EQ(diff.size(), 3u);
+	const std::vector<hv::cfg::ConfigDifference>& differences = diff.getDifferences();
+	EXPECT_EQ(differences[0].name, "diffAdded");
+	EXPECT_TRUE(differences[0].before.is_null());
+	EXPECT_EQ(differences[0].after.get<std::string>(), "new");
+	EXPECT_EQ(differences[1].name, "diffChanged");
+	EXPECT_EQ(differences[1].before.get_int(), 1);
+	EXPECT_EQ(differences[1].after.get_int(), 2);
+	EXPECT_EQ(differences[2].name, "diffRemoved");
+	EXPECT_EQ(differences[2].before.get<std::string>(), "gone");
+	EXPECT_TRUE(differences[2].after.is_null());
+
+	std::stringstream report;
+	EXPECT_TRUE(diff.exportReport(report, hv::cfg::EXPORT_JSON));
+	EXPECT_NE(report.str().find("diffChanged"), std::string::npos);
+	EXPECT_EQ(report.str().find("diffSame"), std::string::npos);
+
+	// Arena values of another layout cannot be compared
+	hv::cfg::Param<int> late("diffLate", 1);
+	EXPECT_FALSE(broker.diff(before, diff));
+}
+
+TEST(CheckpointTest, DiffReusedAddress) {
+	typedef hv::cfg::Param<std::string> StringParam;
+	hv::cfg::Broker broker("Diff reuse broker", false);
+	hv::cfg::BrokerContext context(broker);
+
+	std::aligned_storage<sizeof(StringParam), alignof(StringParam)>::type storage;
+	StringParam* param = new(&storage) StringParam("diffReusedFirst", std::string("first"));
+	const hv::cfg::ConfigSnapshot before = broker.takeSnapshot();
+	param->~StringParam();
+
+	// Another parameter at the same address is not taken for the snapshotted one
+	param = new(&storage) StringParam("diffReusedSecond", std::string("second"));
+	EXPECT_TRUE(param->getSnapshotCCIValue(before).is_null());
+	EXPECT_FALSE(broker.resetAll(hv::cfg::RESET_SNAPSHOT, hv::cfg::RESET_SKIP_CALLBACKS, &before));
+	EXPECT_EQ(param->getValue(), "second");
+
+	hv::cfg::ConfigDiff diff;
+	EXPECT_TRUE(broker.diff(before, diff));
+	EXPECT_EQ(diff.size(), 2u);
+	param->~StringParam();
+}
@@ -0,0 +1,111 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <systemc>
+#include <configuration/configuration.h>
+
+TEST(CommandLineTest, Forms) {
+	const char* const argv[] = {"program",
+			"--param=top.cpu.freq=1000",
+			"--param", "top.cpu.name=\"cpu0\"",
+			"--param", "top.mem.size = 4096",
+			"unrelated"};
+	hv::cfg::CommandLine commandLine(sizeof(argv) / sizeof(*argv), argv);
+	EXPECT_EQ(commandLine.getOverrideCount(), 3u);
+
+	EXPECT_EQ(commandLine.getValue("top.cpu.freq"), "1000");
+	EXPECT_EQ(commandLine.getCCIValue("top.cpu.freq").get_int64(), 1000);
+	EXPECT_EQ(std::string(commandLine.getCCIValue("top.cpu.name").get_string()), "cpu0");
+	EXPECT_EQ(commandLine.getCCIValue("top.mem.size").get_int64(), 4096);
+	EXPECT_FALSE(commandLine.hasValue("unrelated"));
+}
+
+TEST(CommandLineTest, LastOccurrenceWins) {
+	const char* const argv[] = {"program",
+			"--param=top.cpu.freq=1000",
+			"--param", "top.cpu.cores=2",
+			"--param", "top.cpu.freq=2000"};
+	hv::cfg::CommandLine commandLine(sizeof(argv) / sizeof(*argv), argv);
+	EXPECT_EQ(commandLine.getOverrideCount(), 2u);
+	EXPECT_EQ(commandLine.getValue("top.cpu.freq"), "2000");
+	EXPECT_EQ(commandLine.getValues("top.cpu.freq").size(), 1u);
+
+	// Values set after parsing take precedence
+	commandLine.setValue("top.cpu.freq", "3000");
+	EXPECT_EQ(commandLine.getValue("top.cpu.freq"), "3000");
+	commandLine.deleteValue("top.cpu.cores");
+	EXPECT_FALSE(commandLine.hasValue("top.cpu.cores"));
+}
+
+TEST(CommandLineTest, ResponseFile) {
+	const std::string filepath("command-line-test.rsp");
+	{
+		std::ofstream file(filepath.c_str());
+		file << "# Comment\n"
+				"\n"
+				"  top.cpu.freq=2000  \n"
+				"--param top.cpu.cores=4\n"
+				"--param=top.mem.size=4096\n";
+	}
+	const std::string responseFile = "@" + filepath;
+	const char* const argv[] = {"program",
+			"--param=top.cpu.freq=1000",
+			responseFile.c_str(),
+			"--param=top.mem.size=8192"};
+	hv::cfg::CommandLine commandLine(sizeof(argv) / sizeof(*argv), argv);
+	std::remove(filepath.c_str());
+
+	// Response file lines take their place in the command line order
+	EXPECT_EQ(commandLine.getCCIValue("top.cpu.freq").get_int64(), 2000);
+	EXPECT_EQ(commandLine.getCCIValue("top.cpu.cores").get_int64(), 4);
+	EXPECT_EQ(commandLine.getCCIValue("top.mem.size").get_int64(), 8192);
+	EXPECT_FALSE(commandLine.hasValue("# Comment"));
+}
+
+TEST(CommandLineTest, ResponseFileDepth) {
+	// Each file holds one key and includes the next one
+	const int fileCount = HV_CONFIGURATION_STORAGE_COMMAND_LINE_MAX_DEPTH + 1;
+	std::vector<std::string> filepaths;
+	for(int i = 0; i < fileCount; ++i) {
+		filepaths.push_back("command-line-test-" + std::to_string(i) + ".rsp");
+	}
+	for(int i = 0; i < fileCount; ++i) {
+		std::ofstream file(filepaths[i].c_str());
+		file << "depth" << i << "=" << i << "\n";
+		if(i + 1 < fileCount) {
+			file << "@" << filepaths[i + 1] << "\n";
+		}
+	}
+	const std::string responseFile = "@" + filepaths.front();
+	const char* const argv[] = {"program", responseFile.c_str()};
+	hv::cfg::CommandLine commandLine(sizeof(argv) / sizeof(*argv), argv);
+	for(const std::string& filepath : filepaths) {
+		std::remove(filepath.c_str());
+	}
+
+	// Files nested deeper than the limit are ignored
+	for(int i = 0; i < HV_CONFIGURATION_STORAGE_COMMAND_LINE_MAX_DEPTH; ++i) {
+		EXPECT_TRUE(commandLine.hasValue("depth" + std::to_string(i)));
+	}
+	EXPECT_FALSE(commandLine.hasValue("depth" + std::to_string(fileCount - 1)));
+}
+
+TEST(CommandLineTest, Malformed) {
+	const char* const argv[] = {"program",
+			"--param", "novalue",
+			"--param==empty",
+			"--paramtop.cpu.freq=1000",
+			"@command-line-test-missing.rsp",
+			"--param=top.cpu.cores=2",
+			"--param"};
+	hv::cfg::CommandLine commandLine(sizeof(argv) / sizeof(*argv), argv);
+
+	// Malformed arguments are skipped, the others still apply
+	EXPECT_EQ(commandLine.getOverrideCount(), 1u);
+	EXPECT_EQ(commandLine.getValue("top.cpu.cores"), "2");
+	EXPECT_FALSE(commandLine.hasValue("novalue"));
+	EXPECT_FALSE(commandLine.hasValue("top.cpu.freq"));
+	EXPECT_FALSE(commandLine.hasValue(""));
+}
@@ -0,0 +1,52 @@
+#include <cstdlib>
+#include <map>
+#include <string>
+#include <gtest/gtest.h>
+#include <systemc>
+#include <configuration/configuration.h>
+
+TEST(EnvironmentTest, Prefix) {
+	setenv("HVCFG_ENV_TEST_top__cpu__freq", "1000", true);
+	setenv("HVCFG_ENV_TEST_top__name", "\"cpu0\"", true);
+	setenv("HVCFG_ENV_OTHER_top__cpu__freq", "2000", true);
+	hv::cfg::Environment environment("HVCFG_ENV_TEST_");
+
+	// "__" separates the hierarchy levels
+	EXPECT_TRUE(environment.hasValue("top.cpu.freq"));
+	EXPECT_EQ(environment.getValue("top.cpu.freq"), "1000");
+	EXPECT_EQ(environment.getCCIValue("top.cpu.freq").get_int64(), 1000);
+
+	// Enumeration only exposes prefixed variables, with hierarchical keys
+	std::map<std::string, cci::cci_value> values = environment.getCCIValues("");
+	EXPECT_EQ(values.size(), 2u);
+	EXPECT_EQ(values["top.cpu.freq"].get_int64(), 1000);
+	EXPECT_EQ(std::string(values["top.name"].get_string()), "cpu0");
+	EXPECT_EQ(environment.getCCIValues("top.cpu").size(), 1u);
+
+	// Writes go to the prefixed variable and stay enumerated
+	environment.setValue("top.cpu.cores", "4");
+	EXPECT_STREQ(std::getenv("HVCFG_ENV_TEST_top__cpu__cores"), "4");
+	EXPECT_EQ(environment.getCCIValues("").size(), 3u);
+
+	EXPECT_TRUE(environment.reset());
+	EXPECT_FALSE(environment.hasValue("top.cpu.freq"));
+	EXPECT_TRUE(std::getenv("HVCFG_ENV_TEST_top__name") == nullptr);
+	EXPECT_STREQ(std::getenv("HVCFG_ENV_OTHER_top__cpu__freq"), "2000");
+	unsetenv("HVCFG_ENV_OTHER_top__cpu__freq");
+}
+
+TEST(EnvironmentTest, LazyLookup) {
+	unsetenv("HVCFG_ENV_LAZY_top__late");
+	hv::cfg::Environment environment("HVCFG_ENV_LAZY_");
+	EXPECT_FALSE(environment.hasValue("top.late"));
+	EXPECT_EQ(environment.getValue("top.late"), "");
+
+	// Lookups read the process environment, not a copy made at construction
+	setenv("HVCFG_ENV_LAZY_top__late", "42", true);
+	EXPECT_TRUE(environment.hasValue("top.late"));
+	EXPECT_EQ(environment.getCCIValue("top.late").get_int64(), 42);
+
+	environment.deleteValue("top.late");
+	EXPECT_TRUE(std::getenv("HVCFG_ENV_LAZY_top__late") == nullptr);
+	EXPECT_FALSE(environment.hasValue("top.late"));
+}
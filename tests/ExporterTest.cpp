@@ -0,0 +1,55 @@
+#include <sstream>
+#include <string>
+#include <gtest/gtest.h>
+#include <systemc>
+#include <configuration/configuration.h>
+
+TEST(ExporterTest, PresetOnly) {
+	hv::cfg::Broker broker("Export presets broker", false);
+	hv::cfg::BrokerContext context(broker);
+	broker.getCCIBroker().set_preset_cci_value("exportPresetA", cci::cci_value(5),
+			cci::cci_originator("ExporterTest"));
+	hv::cfg::Param<int> preset("exportPresetA", 1);
+	hv::cfg::Param<int> other("exportPresetB", 2);
+
+	hv::cfg::ExportOptions options;
+	options.presetOnly = true;
+	std::ostringstream stream;
+	ASSERT_TRUE(broker.exportParams(stream, options));
+	EXPECT_NE(stream.str().find("exportPresetA"), std::string::npos);
+	EXPECT_EQ(stream.str().find("exportPresetB"), std::string::npos);
+}
+
+TEST(ExporterTest, PresetOnlyStorage) {
+	// Presets read from a user storage
+	hv::cfg::Memory storage;
+	storage.setCCIValue("exportStorageA", cci::cci_value(5));
+	hv::cfg::Broker broker("Export storage broker", &storage, false);
+	hv::cfg::BrokerContext context(broker);
+	hv::cfg::Param<int> preset("exportStorageA", 1);
+	hv::cfg::Param<int> other("exportStorageB", 2);
+	EXPECT_EQ(preset.getValue(), 5);
+
+	hv::cfg::ExportOptions options;
+	options.presetOnly = true;
+	options.format = hv::cfg::EXPORT_JSON;
+	std::ostringstream stream;
+	ASSERT_TRUE(broker.exportParams(stream, options));
+	EXPECT_NE(stream.str().find("\"exportStorageA\""), std::string::npos);
+	EXPECT_EQ(stream.str().find("exportStorageB"), std::string::npos);
+}
+
+TEST(ExporterTest, NonDefaultOnly) {
+	hv::cfg::Broker broker("Export non default broker", false);
+	hv::cfg::BrokerContext context(broker);
+	hv::cfg::Param<int> modified("exportModified", 1);
+	hv::cfg::Param<int> unchanged("exportUnchanged", 2);
+	modified = 3;
+
+	hv::cfg::ExportOptions options;
+	options.nonDefaultOnly = true;
+	std::ostringstream stream;
+	ASSERT_TRUE(broker.exportParams(stream, options));
+	EXPECT_NE(stream.str().find("exportModified: 3"), std::string::npos);
+	EXPECT_EQ(stream.str().find("exportUnchanged"), std::string::npos);
+}
@@ -0,0 +1,88 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <gtest/gtest.h>
+#include <systemc>
+#include <configuration/configuration.h>
+
+TEST(LoaderTest, Precedence) {
+	hv::cfg::Memory base;
+	base.setValue("top.cpu.freq", "1000");
+	base.setValue("top.cpu.name", "\"cpu0\"");
+
+	hv::cfg::Memory overlay;
+	overlay.setValue("top.cpu.freq", "2000");
+
+	hv::cfg::Loader loader;
+	loader.addSource(&base);
+	loader.addSource([]() -> hv::cfg::StorageIf* {
+		hv::cfg::Memory* memory = new hv::cfg::Memory();
+		memory->setValue("top.mem.size", "4096");
+		return memory;
+	});
+	loader.addSource(&overlay);
+	EXPECT_TRUE(loader.load(2));
+
+	EXPECT_EQ(loader.getCCIValue("top.cpu.freq").get_int64(), 2000);
+	EXPECT_EQ(std::string(loader.getCCIValue("top.cpu.name").get_string()), "cpu0");
+	EXPECT_EQ(loader.getCCIValue("top.mem.size").get_int64(), 4096);
+	EXPECT_TRUE(loader.getCCIValue("top.cpu").is_map());
+	EXPECT_FALSE(loader.hasValue("top.gpu"));
+
+	loader.deleteValue("top.cpu");
+	EXPECT_FALSE(loader.hasValue("top.cpu.freq"));
+	EXPECT_TRUE(loader.hasValue("top.mem.size"));
+}
+
+TEST(LoaderTest, MissingYAML) {
+	hv::cfg::Memory base;
+	base.setValue("top.cpu.freq", "1000");
+
+	hv::cfg::Loader loader;
+	loader.addSource(&base);
+	loader.addYAML("loader-test-missing.yaml");
+	EXPECT_FALSE(loader.load(2));
+	EXPECT_EQ(loader.getCCIValue("top.cpu.freq").get_int64(), 1000);
+}
+
+TEST(LoaderTest, YAMLSubtree) {
+	const std::string filepath("loader-test-subtree.yaml");
+	{
+		std::ofstream file(filepath.c_str());
+		file << "top:\n  cpu:\n    freq: 1000\n    cores: [0, 1]\n";
+	}
+	hv::cfg::YAML yaml(filepath, false);
+	std::remove(filepath.c_str());
+	ASSERT_TRUE(yaml.isLoaded());
+	EXPECT_EQ(yaml.getCCIValue("top.cpu.cores").get_list().size(), 2u);
+
+	// A map replaces the whole subtree and is stored as leaves
+	cci::cci_value_map cpu;
+	cpu.push_entry("freq", 2000);
+	yaml.setCCIValue("top.cpu", cci::cci_value(cpu));
+	EXPECT_EQ(yaml.getCCIValue("top.cpu.freq").get_int64(), 2000);
+	EXPECT_FALSE(yaml.hasValue("top.cpu.cores"));
+	EXPECT_TRUE(yaml.getCCIValue("top").is_map());
+
+	yaml.deleteValue("top");
+	EXPECT_FALSE(yaml.hasValue("top.cpu.freq"));
+}
+
+TEST(LoaderTest, YAMLQuoted) {
+	const std::string filepath("loader-test-quoted.yaml");
+	{
+		std::ofstream file(filepath.c_str());
+		file << "top:\n  id: \"1234\"\n  flag: 'true'\n  tag: !!str 12\n  size: 1234\n  enabled: true\n";
+	}
+	hv::cfg::YAML yaml(filepath, false);
+	std::remove(filepath.c_str());
+	ASSERT_TRUE(yaml.isLoaded());
+
+	// Quoted scalars stay strings, plain ones are parsed
+	EXPECT_TRUE(yaml.getCCIValue("top.id").is_string());
+	EXPECT_EQ(std::string(yaml.getCCIValue("top.id").get_string()), "1234");
+	EXPECT_TRUE(yaml.getCCIValue("top.flag").is_string());
+	EXPECT_TRUE(yaml.getCCIValue("top.tag").is_string());
+	EXPECT_EQ(yaml.getCCIValue("top.size").get_int64(), 1234);
+	EXPECT_TRUE(yaml.getCCIValue("top.enabled").get_bool());
+}
@@ -0,0 +1,123 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <gtest/gtest.h>
+#include <systemc>
+#include <configuration/configuration.h>
+
+namespace {
+
+/// Memory counting the values read from it
+class CountingMemory : public hv::cfg::Memory {
+public:
+	CountingMemory() : reads(0) {
+	}
+
+	cci::cci_value getCCIValue(const std::string& key) const override {
+		++reads;
+		return hv::cfg::Memory::getCCIValue(key);
+	}
+
+	mutable unsigned reads;
+};
+
+} // namespace
+
+TEST(OverlayTest, Precedence) {
+	const std::string filepath("overlay-test-precedence.yaml");
+	{
+		std::ofstream file(filepath.c_str());
+		file << "top:\n  cpu:\n    freq: 1000\n    cores: 2\n";
+	}
+	hv::cfg::YAML base(filepath, false);
+	std::remove(filepath.c_str());
+	ASSERT_TRUE(base.isLoaded());
+	hv::cfg::Memory upper;
+	upper.setValue("top.cpu.freq", "2000");
+
+	hv::cfg::Overlay overlay({&base, &upper});
+	EXPECT_EQ(overlay.getLayerCount(), 2u);
+	EXPECT_EQ(overlay.getCCIValue("top.cpu.freq").get_int64(), 2000);
+	EXPECT_EQ(overlay.getCCIValue("top.cpu.cores").get_int64(), 2);
+	EXPECT_FALSE(overlay.hasValue("top.gpu"));
+
+	// Writes through the overlay take precedence over every layer
+	overlay.setCCIValue("top.cpu.freq", cci::cci_value(3000));
+	EXPECT_EQ(overlay.getCCIValue("top.cpu.freq").get_int64(), 3000);
+
+	// Lower layers complete the maps of upper ones
+	cci::cci_value cpu = overlay.getCCIValue("top.cpu");
+	ASSERT_TRUE(cpu.is_map());
+	EXPECT_EQ(cpu.get_map().at("freq").get_int64(), 3000);
+	EXPECT_EQ(cpu.get_map().at("cores").get_int64(), 2);
+
+	overlay.deleteValue("top.cpu.freq");
+	EXPECT_EQ(overlay.getCCIValue("top.cpu.freq").get_int64(), 2000);
+}
+
+TEST(OverlayTest, MapOverride) {
+	hv::cfg::Memory base;
+	base.setValue("top.cpu.freq", "1000");
+	hv::cfg::Overlay overlay({&base});
+
+	// A map written through the overlay answers its children
+	cci::cci_value_map cpu;
+	cpu.push_entry("freq", 2000);
+	cpu.push_entry("cores", 4);
+	overlay.setCCIValue("top.cpu", cci::cci_value(cpu));
+	EXPECT_EQ(overlay.getCCIValue("top.cpu.freq").get_int64(), 2000);
+	EXPECT_EQ(overlay.getCCIValue("top.cpu.cores").get_int64(), 4);
+	EXPECT_TRUE(overlay.getCCIValue("top.cpu").is_map());
+
+	overlay.deleteValue("top.cpu");
+	EXPECT_EQ(overlay.getCCIValue("top.cpu.freq").get_int64(), 1000);
+	EXPECT_FALSE(overlay.hasValue("top.cpu.cores"));
+}
+
+TEST(OverlayTest, Cache) {
+	CountingMemory base;
+	base.setValue("top.cpu.freq", "1000");
+	hv::cfg::Overlay overlay({&base});
+
+	// Resolved keys are read from the layers once
+	EXPECT_EQ(overlay.getCCIValue("top.cpu.freq").get_int64(), 1000);
+	EXPECT_EQ(overlay.getCCIValue("top.cpu.freq").get_int64(), 1000);
+	EXPECT_EQ(base.reads, 1u);
+
+	// Writing to a layer without the overlay leaves the cache stale
+	base.setValue("top.cpu.freq", "2000");
+	EXPECT_EQ(overlay.getCCIValue("top.cpu.freq").get_int64(), 1000);
+	overlay.invalidate("top.cpu.freq");
+	EXPECT_EQ(overlay.getCCIValue("top.cpu.freq").get_int64(), 2000);
+	EXPECT_EQ(base.reads, 2u);
+
+	overlay.setLayerValue(0, "top.cpu.freq", "3000");
+	EXPECT_EQ(overlay.getCCIValue("top.cpu.freq").get_int64(), 3000);
+}
+
+TEST(OverlayTest, Invalidate) {
+	hv::cfg::Memory base;
+	hv::cfg::Overlay overlay({&base});
+	overlay.setCCIValue("top.cpu.freq", cci::cci_value(1000));
+
+	// Writing a key drops its parents
+	EXPECT_EQ(overlay.getCCIValue("top").get_map().at("cpu").get_map().size(), 1u);
+	overlay.setCCIValue("top.cpu.cores", cci::cci_value(2));
+	EXPECT_EQ(overlay.getCCIValue("top").get_map().at("cpu").get_map().size(), 2u);
+	EXPECT_EQ(overlay.getCCIValue("top.cpu").get_map().size(), 2u);
+
+	// Writing a map drops its children
+	EXPECT_EQ(overlay.getCCIValue("top.cpu.freq").get_int64(), 1000);
+	cci::cci_value_map cpu;
+	cpu.push_entry("freq", 2000);
+	overlay.setCCIValue("top.cpu", cci::cci_value(cpu));
+	EXPECT_EQ(overlay.getCCIValue("top.cpu.freq").get_int64(), 2000);
+	EXPECT_FALSE(overlay.hasValue("top.cpu.cores"));
+
+	// Invalidating a key drops its children
+	overlay.setLayerValue(0, "top.mem", "4096");
+	EXPECT_EQ(overlay.getCCIValue("top.mem").get_int64(), 4096);
+	base.setValue("top.mem", "8192");
+	overlay.invalidate("top");
+	EXPECT_EQ(overlay.getCCIValue("top.mem").get_int64(), 8192);
+}
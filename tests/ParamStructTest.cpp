@@ -0,0 +1,84 @@
+#include <sstream>
+#include <string>
+#include <gtest/gtest.h>
+#include <systemc>
+#include <configuration/configuration.h>
+
+struct StructTestConfig {
+	StructTestConfig() : name(), size(0), ratio(0.0) {}
+	std::string name;
+	int size;
+	double ratio;
+};
+
+inline bool operator==(const StructTestConfig& lhs, const StructTestConfig& rhs) {
+	return lhs.name == rhs.name && lhs.size == rhs.size && lhs.ratio == rhs.ratio;
+}
+
+HV_CFG_STRUCT(StructTestConfig, name, size, ratio)
+
+namespace {
+
+StructTestConfig makeConfig(const std::string& name, int size, double ratio) {
+	StructTestConfig config;
+	config.name = name;
+	config.size = size;
+	config.ratio = ratio;
+	return config;
+}
+
+} // namespace
+
+TEST(ParamStructTest, RoundTrip) {
+	const StructTestConfig config = makeConfig("dma", 16, 0.5);
+
+	// Structs are maps with one entry per field
+	cci::cci_value value(config);
+	ASSERT_TRUE(value.is_map());
+	EXPECT_EQ(value.get_map().size(), 3u);
+	EXPECT_EQ(std::string(value.get_map().at("name").get_string()), "dma");
+	EXPECT_EQ(value.get_map().at("size").get_int(), 16);
+
+	StructTestConfig unpacked;
+	ASSERT_TRUE(value.try_get(unpacked));
+	EXPECT_EQ(unpacked, config);
+
+	// Fields may come in any order, unknown keys are ignored
+	cci::cci_value_map reordered;
+	reordered.push_entry("ratio", 0.25);
+	reordered.push_entry("unknown", 1);
+	reordered.push_entry("size", 8);
+	reordered.push_entry("name", "uart");
+	ASSERT_TRUE(cci::cci_value(reordered).try_get(unpacked));
+	EXPECT_EQ(unpacked, makeConfig("uart", 8, 0.25));
+}
+
+TEST(ParamStructTest, MissingField) {
+	cci::cci_value_map incomplete;
+	incomplete.push_entry("name", "dma");
+	incomplete.push_entry("size", 16);
+	StructTestConfig unpacked;
+	EXPECT_FALSE(cci::cci_value(incomplete).try_get(unpacked));
+
+	// A field of the wrong type is rejected too
+	cci::cci_value_map mistyped;
+	mistyped.push_entry("name", "dma");
+	mistyped.push_entry("size", "sixteen");
+	mistyped.push_entry("ratio", 0.5);
+	EXPECT_FALSE(cci::cci_value(mistyped).try_get(unpacked));
+	EXPECT_FALSE(cci::cci_value(16).try_get(unpacked));
+}
+
+TEST(ParamStructTest, Checkpoint) {
+	hv::cfg::Broker broker("Struct checkpoint broker", false);
+	hv::cfg::BrokerContext context(broker);
+	hv::cfg::Param<StructTestConfig> param("structCheckpoint", makeConfig("dma", 16, 0.5));
+	EXPECT_EQ(broker.getCCIBroker().get_param_handle("structCheckpoint", cci::cci_originator("ParamStructTest"))
+			.get_data_category(), cci::CCI_OTHER_PARAM);
+
+	std::stringstream stream;
+	ASSERT_TRUE(broker.checkpoint(stream));
+	param = makeConfig("uart", 8, 0.25);
+	ASSERT_TRUE(broker.restore(stream));
+	EXPECT_EQ(param.getValue(), makeConfig("dma", 16, 0.5));
+}
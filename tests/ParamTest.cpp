@@ -1,8 +1,25 @@
-#include <iostream>
+#include <array>
+#include <cstdint>
+#include <deque>
+#include <list>
+#include <memory>
+#include <string>
+#include <vector>
 #include <gtest/gtest.h>
 #include <systemc>
 #include <configuration/configuration.h>
 
+struct CategoryStruct {
+	CategoryStruct() : size(0) {}
+	int size;
+};
+
+inline bool operator==(const CategoryStruct& lhs, const CategoryStruct& rhs) {
+	return lhs.size == rhs.size;
+}
+
+HV_CFG_STRUCT(CategoryStruct, size)
+
 class SimpleModule : public sc_core::sc_module {
 	SC_HAS_PROCESS(SimpleModule);
 public:
@@ -19,6 +36,43 @@ private:
 	hv::cfg::Param<int> t;
 };
 
+class NestedInnerModule : public sc_core::sc_module {
+public:
+	NestedInnerModule(sc_core::sc_module_name name) :
+			sc_core::sc_module(name),
+			value("value", 1) {
+	}
+
+	hv::cfg::Param<int> value;
+};
+
+class NestedOuterModule : public sc_core::sc_module {
+public:
+	NestedOuterModule(sc_core::sc_module_name name) :
+			sc_core::sc_module(name),
+			value("value", 1),
+			inner("inner"),
+			after("after", 2) {
+	}
+
+	hv::cfg::Param<int> value;
+	NestedInnerModule inner;
+	hv::cfg::Param<int> after;
+};
+
+/// Parameter exposing its CCI parameter
+class CCIParam : public hv::cfg::Param<int> {
+public:
+	explicit CCIParam(const std::string& name, const std::string& description = "") :
+			hv::cfg::ParamBase<int>(name, 0, description),
+			hv::cfg::Param<int>(name, 0, description) {
+	}
+
+	hv::cfg::ParamCCI<int>& getParamCCI() {
+		return dynamic_cast<hv::cfg::ParamCCI<int>&>(*this->cciParam);
+	}
+};
+
 class ParamTest: public ::testing::Test {
 protected:
     virtual void SetUp() {
@@ -36,6 +90,244 @@ TEST_F(ParamTest, DefaultValue) {
     EXPECT_EQ(m->getParamValue(), x);
 }
 
+namespace {
+
+/// Polymorphic interface, one vtable pointer
+struct FootprintInterface {
+	virtual ~FootprintInterface() {}
+};
+
+/// Expected layout of ParamBase<T>: its interfaces, name, values and a few words
+template<typename T>
+struct ParamBaseLayout : FootprintInterface, hv::cfg::PresetListenerIf {
+	std::string name;
+	typename hv::cfg::ParamValueStorage<T>::Type valueStorage;
+	T defaultValue;
+	void* cciParam;
+	hv::cfg::DescriptionPtr description;
+	void* broker;
+	void* cold;
+	std::uint8_t flags;
+	std::uint32_t dirtyIndex;
+};
+
+/// Expected layout of ParamCCI<T>: its interfaces, the parameter, two originator IDs and a word
+struct ParamCCILayout : FootprintInterface, hv::cfg::PresetListenerIf {
+	void* paramBase;
+	hv::cfg::OriginatorId originatorId;
+	hv::cfg::OriginatorId valueOriginatorId;
+	void* cold;
+};
+
+} // namespace
+
+TEST(ParamTest, Footprint) {
+	// Descriptions, callbacks, handles, metadata, presets and locks live in cold
+	// blocks: a parameter only holds its name, values and a few words
+	EXPECT_EQ(sizeof(hv::cfg::ParamBase<int>), sizeof(ParamBaseLayout<int>));
+	EXPECT_EQ(sizeof(hv::cfg::ParamBase<std::string>), sizeof(ParamBaseLayout<std::string>));
+	EXPECT_EQ(sizeof(hv::cfg::ParamCCI<int>), sizeof(ParamCCILayout));
+
+	// Param adds its virtual base pointer
+	EXPECT_EQ(sizeof(hv::cfg::Param<int>),
+			sizeof(void*) + sizeof(ParamCCILayout) + sizeof(ParamBaseLayout<int>));
+}
+
+TEST(ParamTest, DataCategory) {
+	// Known type families have a static category
+	EXPECT_TRUE(hv::cfg::ParamDataCategoryTrait<bool>::isStatic());
+	EXPECT_EQ(hv::cfg::ParamDataCategoryTrait<bool>::category(), cci::CCI_BOOL_PARAM);
+	EXPECT_EQ(hv::cfg::ParamDataCategoryTrait<char>::category(), cci::CCI_INTEGRAL_PARAM);
+	EXPECT_EQ(hv::cfg::ParamDataCategoryTrait<std::uint64_t>::category(), cci::CCI_INTEGRAL_PARAM);
+	EXPECT_EQ(hv::cfg::ParamDataCategoryTrait<float>::category(), cci::CCI_REAL_PARAM);
+	EXPECT_EQ(hv::cfg::ParamDataCategoryTrait<double>::category(), cci::CCI_REAL_PARAM);
+	EXPECT_EQ(hv::cfg::ParamDataCategoryTrait<std::string>::category(), cci::CCI_STRING_PARAM);
+	EXPECT_EQ(hv::cfg::ParamDataCategoryTrait<std::vector<int> >::category(), cci::CCI_LIST_PARAM);
+	EXPECT_EQ(hv::cfg::ParamDataCategoryTrait<std::list<int> >::category(), cci::CCI_LIST_PARAM);
+	EXPECT_EQ(hv::cfg::ParamDataCategoryTrait<std::deque<std::string> >::category(), cci::CCI_LIST_PARAM);
+	EXPECT_EQ((hv::cfg::ParamDataCategoryTrait<std::array<int, 2> >::category()), cci::CCI_LIST_PARAM);
+	EXPECT_TRUE(hv::cfg::ParamDataCategoryTrait<CategoryStruct>::isStatic());
+	EXPECT_EQ(hv::cfg::ParamDataCategoryTrait<CategoryStruct>::category(), cci::CCI_OTHER_PARAM);
+
+	// Other types are inspected through their CCI value
+	EXPECT_FALSE(hv::cfg::ParamDataCategoryTrait<sc_core::sc_time>::isStatic());
+
+	// Parameters report the category of their type
+	hv::cfg::Param<bool> boolParam("paramCategoryBool", true);
+	hv::cfg::Param<int> intParam("paramCategoryInt", 1);
+	hv::cfg::Param<double> realParam("paramCategoryReal", 1.0);
+	hv::cfg::Param<std::string> stringParam("paramCategoryString", std::string("s"));
+	hv::cfg::Param<std::vector<int> > listParam("paramCategoryList", std::vector<int>());
+	hv::cfg::Param<CategoryStruct> structParam("paramCategoryStruct", CategoryStruct());
+	cci::cci_broker_handle broker = cci::cci_get_broker();
+	EXPECT_EQ(broker.get_param_handle("paramCategoryBool").get_data_category(), cci::CCI_BOOL_PARAM);
+	EXPECT_EQ(broker.get_param_handle("paramCategoryInt").get_data_category(), cci::CCI_INTEGRAL_PARAM);
+	EXPECT_EQ(broker.get_param_handle("paramCategoryReal").get_data_category(), cci::CCI_REAL_PARAM);
+	EXPECT_EQ(broker.get_param_handle("paramCategoryString").get_data_category(), cci::CCI_STRING_PARAM);
+	EXPECT_EQ(broker.get_param_handle("paramCategoryList").get_data_category(), cci::CCI_LIST_PARAM);
+	EXPECT_EQ(broker.get_param_handle("paramCategoryStruct").get_data_category(), cci::CCI_OTHER_PARAM);
+}
+
+TEST(ParamTest, SharedMetadata) {
+	CCIParam a("paramMetadataA");
+	CCIParam b("paramMetadataB");
+	const std::size_t metadataCount = hv::cfg::getMetadataCount();
+
+	// Parameters with the same metadata share a single map
+	a.getParamCCI().add_metadata("paramMetadataUnit", cci::cci_value("Hz"), "Unit");
+	b.getParamCCI().add_metadata("paramMetadataUnit", cci::cci_value("Hz"), "Unit");
+	EXPECT_EQ(hv::cfg::getMetadataCount(), metadataCount + 1);
+	EXPECT_EQ(&a.getParamCCI().getMetadata(), &b.getParamCCI().getMetadata());
+
+	// Adding an entry copies the map of this parameter only
+	a.getParamCCI().add_metadata("paramMetadataMax", cci::cci_value(100), "Maximum");
+	EXPECT_EQ(hv::cfg::getMetadataCount(), metadataCount + 2);
+	EXPECT_NE(&a.getParamCCI().getMetadata(), &b.getParamCCI().getMetadata());
+	EXPECT_EQ(a.getParamCCI().get_metadata().size(), 2u);
+	EXPECT_EQ(b.getParamCCI().get_metadata().size(), 1u);
+	EXPECT_TRUE(a.getParamCCI().get_metadata().has_entry("paramMetadataMax"));
+	EXPECT_FALSE(b.getParamCCI().get_metadata().has_entry("paramMetadataMax"));
+}
+
+TEST(ParamTest, NestedNames) {
+	NestedOuterModule outer("paramNestedOuter");
+	EXPECT_EQ(outer.value.getName(), "paramNestedOuter.value");
+	EXPECT_EQ(outer.inner.value.getName(), "paramNestedOuter.inner.value");
+
+	// Leaving a child module restores the prefix of its parent
+	EXPECT_EQ(outer.after.getName(), "paramNestedOuter.after");
+
+	cci::cci_broker_handle broker = cci::cci_get_broker();
+	EXPECT_TRUE(broker.get_param_handle("paramNestedOuter.inner.value").is_valid());
+	EXPECT_TRUE(broker.get_param_handle("paramNestedOuter.after").is_valid());
+
+	// A module allocated where a destroyed one lived gets its own prefix
+	std::unique_ptr<NestedInnerModule> first(new NestedInnerModule("paramNestedFirst"));
+	EXPECT_EQ(first->value.getName(), "paramNestedFirst.value");
+	first.reset();
+	first.reset(new NestedInnerModule("paramNestedSecond"));
+	EXPECT_EQ(first->value.getName(), "paramNestedSecond.value");
+}
+
+TEST(ParamTest, InternedDescription) {
+	CCIParam a("paramDescriptionA", "Interned description");
+	CCIParam b("paramDescriptionB", "Interned description");
+	CCIParam c("paramDescriptionC");
+	const std::size_t descriptionCount = hv::cfg::getDescriptionCount();
+
+	// Parameters with the same description share it
+	EXPECT_EQ(&a.getDescription(), &b.getDescription());
+	EXPECT_EQ(a.getDescription(), "Interned description");
+	EXPECT_EQ(c.getDescription(), "");
+
+	// Updating one description leaves the other parameters untouched
+	a.getParamCCI().set_description("Updated description");
+	EXPECT_EQ(a.getParamCCI().get_description(), "Updated description");
+	EXPECT_EQ(b.getDescription(), "Interned description");
+	EXPECT_NE(&a.getDescription(), &b.getDescription());
+	EXPECT_EQ(hv::cfg::getDescriptionCount(), descriptionCount + 1);
+
+	// Setting an interned description again shares it
+	c.setDescription("Updated description");
+	EXPECT_EQ(&a.getDescription(), &c.getDescription());
+	EXPECT_EQ(hv::cfg::getDescriptionCount(), descriptionCount + 1);
+}
+
+TEST(ParamArrayTest, Elements) {
+	hv::cfg::ParamArray<std::uint32_t, 4> regs("paramArrayRegs", 0u);
+	EXPECT_EQ(regs.size(), 4u);
+
+	EXPECT_TRUE(regs.set(1, 7));
+	EXPECT_FALSE(regs.set(4, 7));
+	const std::uint32_t values[] = {8, 9};
+	EXPECT_TRUE(regs.assign(values, 2, 2));
+	EXPECT_EQ(regs.getValue(), (std::array<std::uint32_t, 4>{{0, 7, 8, 9}}));
+
+	cci::cci_param_handle handle = cci::cci_get_broker().get_param_handle("paramArrayRegs");
+	ASSERT_TRUE(handle.is_valid());
+	EXPECT_EQ(handle.get_data_category(), cci::CCI_LIST_PARAM);
+	handle.set_cci_value(cci::cci_value(cci::cci_value_list().push_back(1).push_back(2)
+			.push_back(3).push_back(4)));
+	EXPECT_EQ(regs[3], 4u);
+
+	regs.reset();
+	EXPECT_EQ(regs[1], 0u);
+}
+
+TEST(ParamCallbackTest, ReentrantWrite) {
+	hv::cfg::Param<std::string> state("paramCallbackState", std::string("idle"));
+	cci::cci_param_typed_handle<std::string> handle(cci::cci_get_broker().get_param_handle("paramCallbackState"));
+	ASSERT_TRUE(handle.is_valid());
+
+	// A write from a post write callback must not alter the outer write event
+	std::vector<std::string> oldValues;
+	handle.register_post_write_callback([&](const cci::cci_param_write_event<std::string>& ev) {
+		if(ev.new_value == "start") {
+			handle.set_value(std::string("running"));
+		}
+	});
+	handle.register_post_write_callback([&](const cci::cci_param_write_event<std::string>& ev) {
+		oldValues.push_back(ev.old_value);
+	});
+
+	handle.set_value(std::string("start"));
+	EXPECT_EQ(state.getValue(), "running");
+	EXPECT_EQ(oldValues, std::vector<std::string>({"idle"}));
+}
+
+TEST(ParamCallbackTest, UntypedWrite) {
+	hv::cfg::Param<int> param("paramCallbackUntyped", 1);
+	cci::cci_param_untyped_handle handle(cci::cci_get_broker().get_param_handle("paramCallbackUntyped"));
+	ASSERT_TRUE(handle.is_valid());
+
+	std::vector<int> preValues;
+	std::vector<int> postValues;
+	handle.register_pre_write_callback(cci::cci_param_pre_write_callback_untyped(
+			[&](const cci::cci_param_write_event<>& ev) {
+		preValues.push_back(ev.old_value.get_int());
+		preValues.push_back(ev.new_value.get_int());
+		return ev.new_value.get_int() >= 0;
+	}));
+	handle.register_post_write_callback(cci::cci_param_post_write_callback_untyped(
+			[&](const cci::cci_param_write_event<>& ev) {
+		postValues.push_back(ev.old_value.get_int());
+		postValues.push_back(ev.new_value.get_int());
+	}));
+
+	// HV writes run untyped CCI callbacks too
+	param.setValue(2);
+	EXPECT_EQ(preValues, std::vector<int>({1, 2}));
+	EXPECT_EQ(postValues, std::vector<int>({1, 2}));
+
+	// An untyped pre write callback can reject the value
+	param.setValue(-1);
+	EXPECT_EQ(param.getValue(), 2);
+}
+
+TEST(ParamCallbackTest, ValueOrigin) {
+	hv::cfg::Param<int> param("paramValueOrigin", 0);
+	cci::cci_broker_if& broker = hv::cfg::getBroker()->getCCIBroker();
+	cci::cci_param_untyped_handle writerA = broker.get_param_handle("paramValueOrigin",
+			cci::cci_originator("paramValueOriginA"));
+	cci::cci_param_untyped_handle writerB = broker.get_param_handle("paramValueOrigin",
+			cci::cci_originator("paramValueOriginB"));
+	ASSERT_TRUE(writerA.is_valid());
+	ASSERT_TRUE(writerB.is_valid());
+
+	// Nothing was registered by this originator
+	EXPECT_FALSE(writerB.unregister_all_callbacks());
+
+	// The origin follows the writer, including repeated writes
+	writerA.set_cci_value(cci::cci_value(1));
+	writerA.set_cci_value(cci::cci_value(2));
+	EXPECT_STREQ(writerA.get_value_origin().name(), "paramValueOriginA");
+	writerB.set_cci_value(cci::cci_value(3));
+	EXPECT_STREQ(writerA.get_value_origin().name(), "paramValueOriginB");
+	writerA.set_cci_value(cci::cci_value(4));
+	EXPECT_STREQ(writerA.get_value_origin().name(), "paramValueOriginA");
+	EXPECT_EQ(param.getValue(), 4);
+}
+
 int sc_main(int argc, char* argv[])
 {
 	hv::cfg::Broker hiventiveBroker("Hiventive broker");
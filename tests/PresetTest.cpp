@@ -0,0 +1,75 @@
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+#include <map>
+#include <string>
+#include <vector>
+#include <gtest/gtest.h>
+#include <systemc>
+#include <configuration/configuration.h>
+
+namespace {
+
+std::vector<std::string> unconsumedPresetNames(cci::cci_broker_if& broker) {
+	std::vector<std::string> names;
+	for(auto const &entry : broker.get_unconsumed_preset_values()) {
+		names.push_back(entry.first);
+	}
+	return names;
+}
+
+} // namespace
+
+TEST(PresetTest, Bookkeeping) {
+	const std::string filepath("preset-test-bookkeeping.yaml");
+	{
+		std::ofstream file(filepath.c_str());
+		file << "presetTop:\n  cpu: 5\n  mem: 6\n";
+	}
+	hv::cfg::YAML storage(filepath, false);
+	std::remove(filepath.c_str());
+	ASSERT_TRUE(storage.isLoaded());
+	hv::cfg::Broker broker("Preset bookkeeping broker", &storage, false);
+	hv::cfg::BrokerContext context(broker);
+	cci::cci_broker_if& cciBroker = broker.getCCIBroker();
+
+	cciBroker.set_preset_cci_value("presetOther", cci::cci_value(7), cci::cci_originator("PresetTest"));
+	hv::cfg::Param<int> cpu("presetTop.cpu", 1);
+	EXPECT_EQ(cpu.getValue(), 5);
+	cciBroker.lock_preset_value("presetOther");
+
+	// Used and locked presets are tracked by the broker, not in the user storage
+	std::map<std::string, cci::cci_value> values = storage.getCCIValues("");
+	EXPECT_EQ(values.size(), 3u);
+	EXPECT_EQ(values.count("presetTop.cpu"), 1u);
+	EXPECT_EQ(values.count("presetTop.mem"), 1u);
+	EXPECT_EQ(values.count("presetOther"), 1u);
+
+	std::vector<std::string> unconsumed = unconsumedPresetNames(cciBroker);
+	EXPECT_NE(std::find(unconsumed.begin(), unconsumed.end(), "presetOther"), unconsumed.end());
+	EXPECT_EQ(std::find(unconsumed.begin(), unconsumed.end(), "presetTop.cpu"), unconsumed.end());
+}
+
+TEST(PresetTest, CachedPreset) {
+	hv::cfg::Broker broker("Preset cache broker", false);
+	hv::cfg::BrokerContext context(broker);
+	cci::cci_broker_if& cciBroker = broker.getCCIBroker();
+	hv::cfg::Param<int> param("presetCached", 1);
+	cci::cci_param_untyped_handle handle = cciBroker.get_param_handle("presetCached",
+			cci::cci_originator("PresetTest"));
+	ASSERT_TRUE(handle.is_valid());
+	EXPECT_FALSE(handle.is_preset_value());
+
+	// Presets set through the broker refresh the cached preset of the parameter
+	cciBroker.set_preset_cci_value("presetCached", cci::cci_value(1), cci::cci_originator("PresetTest"));
+	EXPECT_TRUE(handle.is_preset_value());
+	cciBroker.set_preset_cci_value("presetCached", cci::cci_value(2), cci::cci_originator("PresetTest"));
+	EXPECT_FALSE(handle.is_preset_value());
+	param = 2;
+	EXPECT_TRUE(handle.is_preset_value());
+
+	// Resetting to the preset uses the refreshed value
+	param = 3;
+	broker.resetAll(hv::cfg::RESET_PRESET, hv::cfg::RESET_SKIP_CALLBACKS);
+	EXPECT_EQ(param.getValue(), 2);
+}
@@ -0,0 +1,74 @@
+#include <cstdio>
+#include <fstream>
+#include <string>
+#include <gtest/gtest.h>
+#include <systemc>
+#include <configuration/configuration.h>
+
+struct ReloaderStruct {
+	ReloaderStruct() : a(0), b(0) {}
+	int a;
+	int b;
+};
+
+inline bool operator==(const ReloaderStruct& lhs, const ReloaderStruct& rhs) {
+	return lhs.a == rhs.a && lhs.b == rhs.b;
+}
+
+HV_CFG_STRUCT(ReloaderStruct, a, b)
+
+namespace {
+
+/// Reloader applying its changes on demand instead of from the update phase
+class ManualReloader : public hv::cfg::Reloader {
+public:
+	ManualReloader(const std::string& filepath, cci::cci_broker_handle broker) :
+			hv::cfg::Reloader(filepath, broker, "reloaderTest") {
+	}
+
+	using hv::cfg::Reloader::update;
+};
+
+} // namespace
+
+TEST(ReloaderTest, Reload) {
+	hv::cfg::Broker broker("Reloader broker", false);
+	hv::cfg::BrokerContext context(broker);
+	cci::cci_broker_handle handle = broker.getCCIBroker().create_broker_handle(
+			cci::cci_originator("ReloaderTest"));
+	hv::cfg::Param<int> value("reloaderValue", 1);
+	hv::cfg::Param<int> locked("reloaderLocked", 2);
+	hv::cfg::Param<int> scalar("reloaderScalar", 3);
+	hv::cfg::Param<ReloaderStruct> structured("reloaderStruct", ReloaderStruct());
+	ASSERT_TRUE(handle.get_param_handle("reloaderLocked").lock());
+
+	const std::string filepath("reloader-test.yaml");
+	{
+		std::ofstream file(filepath.c_str());
+		file << "reloaderValue: 1\nreloaderLocked: 2\nreloaderStruct:\n  a: 0\n  b: 0\n";
+	}
+	ManualReloader reloader(filepath, handle);
+	{
+		std::ofstream file(filepath.c_str());
+		file << "reloaderValue: 4\nreloaderLocked: 5\nreloaderStruct:\n  a: 0\n  b: 6\n"
+				"reloaderNew: 7\nreloaderScalar:\n  extra: 8\n";
+	}
+	EXPECT_EQ(reloader.reload(), 5u);
+	std::remove(filepath.c_str());
+	reloader.update();
+
+	// Changed keys update their parameter, a changed field its struct
+	EXPECT_EQ(value.getValue(), 4);
+	EXPECT_EQ(structured.getValue().a, 0);
+	EXPECT_EQ(structured.getValue().b, 6);
+
+	// Locked parameters are untouched
+	EXPECT_EQ(locked.getValue(), 2);
+
+	// Keys without a parameter become presets, including keys below a non map parameter
+	EXPECT_EQ(scalar.getValue(), 3);
+	EXPECT_TRUE(handle.has_preset_value("reloaderNew"));
+	EXPECT_EQ(handle.get_preset_cci_value("reloaderNew").get_int(), 7);
+	EXPECT_TRUE(handle.has_preset_value("reloaderScalar.extra"));
+	EXPECT_EQ(handle.get_preset_cci_value("reloaderScalar.extra").get_int(), 8);
+}